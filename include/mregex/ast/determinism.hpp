@@ -0,0 +1,64 @@
+#ifndef MREGEX_AST_DETERMINISM_HPP
+#define MREGEX_AST_DETERMINISM_HPP
+
+#include <array>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/first_set.hpp>
+#include <mregex/ast/fixed_width.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/utility/char_set.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<std::size_t N>
+        constexpr bool are_pairwise_disjoint(std::array<char_set, N> const &sets) noexcept
+        {
+            char_set seen;
+            for (auto const &set : sets)
+            {
+                if (seen.intersects(set))
+                    return false;
+                seen = seen | set;
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Type trait used to detect AST nodes which can end in at most one position
+     * when matched from a given position.
+     *
+     * @note Deterministic nodes have nothing to backtrack into. They can be matched with
+     * a continuation that always succeeds and the end of the match is the only possible one.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr bool is_deterministic = is_fixed_width_matchable<Node> || is_assertion<Node>;
+
+    template<>
+    inline constexpr bool is_deterministic<empty> = true;
+
+    template<typename... Nodes>
+    requires (!is_fixed_width_matchable<sequence<Nodes ...>>)
+    inline constexpr bool is_deterministic<sequence<Nodes ...>> = (is_deterministic<Nodes> && ...);
+
+    template<typename... Nodes>
+    requires (!is_fixed_width_matchable<alternation<Nodes ...>>)
+    inline constexpr bool is_deterministic<alternation<Nodes ...>> =
+            (is_deterministic<Nodes> && ...) &&
+            detail::are_pairwise_disjoint(std::array<char_set, sizeof...(Nodes)>{
+                (any_flags_first_set<Nodes>::nullable ? char_set::full() : any_flags_first_set<Nodes>::chars) ...
+            });
+
+    template<std::size_t ID, typename Name, typename Inner>
+    inline constexpr bool is_deterministic<capture<ID, Name, Inner>> = is_deterministic<Inner>;
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    requires (!is_fixed_width_matchable<basic_repetition<Mode, A, B, Inner>>)
+    inline constexpr bool is_deterministic<basic_repetition<Mode, A, B, Inner>> =
+            Mode == match_mode::possessive || (std::is_same_v<A, B> && is_deterministic<Inner>);
+}
+#endif //MREGEX_AST_DETERMINISM_HPP
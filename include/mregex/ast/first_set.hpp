@@ -0,0 +1,139 @@
+#ifndef MREGEX_AST_FIRST_SET_HPP
+#define MREGEX_AST_FIRST_SET_HPP
+
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/utility/char_set.hpp>
+#include <mregex/regex_flags.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        /**
+         * Minimal context type that only carries flags.
+         * Trivially matchable nodes only look at the flags of the context they receive.
+         */
+        template<typename Flags>
+        struct flags_context
+        {
+            using flags = Flags;
+        };
+
+        template<typename Node, typename Flags>
+        constexpr char_set enumerate_chars() noexcept
+        {
+            flags_context<Flags> ctx;
+            char_set result;
+            for (std::size_t byte = 0; byte != char_set::size; ++byte)
+            {
+                auto const input = static_cast<char>(byte);
+                if (Node::match_one(input, ctx))
+                    result.insert(input);
+            }
+            return result;
+        }
+    }
+
+    /**
+     * Metafunction that computes the FIRST set of an AST node, i.e. the set of characters
+     * which can be consumed first when the node matches.
+     * If the node is nullable, it may also match without consuming any characters.
+     *
+     * @note The result is conservative: nodes which cannot be analyzed statically, like backreferences,
+     * are considered to possibly start with any character.
+     *
+     * @tparam Node     The AST node
+     * @tparam Flags    The flags used for matching
+     */
+    template<typename Node, typename Flags>
+    struct first_set
+    {
+        static constexpr char_set chars = char_set::full();
+        static constexpr bool nullable = true;
+    };
+
+    template<typename Node, typename Flags>
+    requires is_trivially_matchable<Node>
+    struct first_set<Node, Flags>
+    {
+        static constexpr char_set chars = detail::enumerate_chars<Node, Flags>();
+        static constexpr bool nullable = false;
+    };
+
+    template<typename Node, typename Flags>
+    requires is_assertion<Node>
+    struct first_set<Node, Flags>
+    {
+        static constexpr char_set chars{};
+        static constexpr bool nullable = true;
+    };
+
+    template<typename Flags>
+    struct first_set<empty, Flags>
+    {
+        static constexpr char_set chars{};
+        static constexpr bool nullable = true;
+    };
+
+    template<typename First, typename Flags>
+    requires (!is_trivially_matchable<sequence<First>>)
+    struct first_set<sequence<First>, Flags> : first_set<First, Flags> {};
+
+    template<typename First, typename... Rest, typename Flags>
+    requires (!is_trivially_matchable<sequence<First, Rest ...>>)
+    struct first_set<sequence<First, Rest ...>, Flags>
+    {
+        using first_type = first_set<First, Flags>;
+        using rest_type = first_set<sequence<Rest ...>, Flags>;
+
+        static constexpr char_set chars = first_type::nullable ? first_type::chars | rest_type::chars : first_type::chars;
+        static constexpr bool nullable = first_type::nullable && rest_type::nullable;
+    };
+
+    template<typename... Nodes, typename Flags>
+    requires (!is_trivially_matchable<alternation<Nodes ...>>)
+    struct first_set<alternation<Nodes ...>, Flags>
+    {
+        static constexpr char_set chars = (first_set<Nodes, Flags>::chars | ...);
+        static constexpr bool nullable = (first_set<Nodes, Flags>::nullable || ...);
+    };
+
+    template<std::size_t ID, typename Name, typename Inner, typename Flags>
+    struct first_set<capture<ID, Name, Inner>, Flags> : first_set<Inner, Flags> {};
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner, typename Flags>
+    struct first_set<basic_repetition<Mode, A, B, Inner>, Flags>
+    {
+        static constexpr char_set chars = first_set<Inner, Flags>::chars;
+        static constexpr bool nullable = symbol::is_zero<A> || first_set<Inner, Flags>::nullable;
+    };
+
+    /**
+     * Computes a FIRST set which holds regardless of the flags used for matching.
+     * This is useful when analyzing the AST before the flags are known.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    struct any_flags_first_set
+    {
+        static constexpr char_set chars =
+                first_set<Node, regex_flag_sequence<>>::chars |
+                first_set<Node, regex_flag_sequence<regex_flag::icase>>::chars |
+                first_set<Node, regex_flag_sequence<regex_flag::dotall>>::chars |
+                first_set<Node, regex_flag_sequence<regex_flag::icase, regex_flag::dotall>>::chars;
+        static constexpr bool nullable = first_set<Node, regex_flag_sequence<>>::nullable;
+    };
+
+    /**
+     * Computes the set of characters at which a node can start matching.
+     * This is the FIRST set for non-nullable nodes. Nullable nodes can start matching anywhere.
+     *
+     * @tparam Node     The AST node
+     * @tparam Flags    The flags used for matching
+     */
+    template<typename Node, typename Flags>
+    inline constexpr char_set start_set = first_set<Node, Flags>::nullable ? char_set::full() : first_set<Node, Flags>::chars;
+}
+#endif //MREGEX_AST_FIRST_SET_HPP
@@ -0,0 +1,94 @@
+#ifndef MREGEX_AST_FIXED_WIDTH_HPP
+#define MREGEX_AST_FIXED_WIDTH_HPP
+
+#include <iterator>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+
+namespace meta::ast
+{
+    /**
+     * Type trait used to detect AST nodes which always match a fixed number of characters
+     * and are made only of trivially matchable parts.
+     *
+     * @note Such nodes can be matched without any continuation. They can only end at one position,
+     * so there is nothing to backtrack into. This allows repeating them in a simple loop.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr bool is_fixed_width_matchable = is_trivially_matchable<Node>;
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<sequence<Nodes ...>>)
+    inline constexpr bool is_fixed_width_matchable<sequence<Nodes ...>> = (is_fixed_width_matchable<Nodes> && ...);
+
+    template<typename First, typename... Rest>
+    requires (!is_trivially_matchable<alternation<First, Rest ...>>)
+    inline constexpr bool is_fixed_width_matchable<alternation<First, Rest ...>> =
+            (is_fixed_width_matchable<First> && ... && is_fixed_width_matchable<Rest>) &&
+            ((min_width<First> == min_width<Rest>) && ...);
+
+    template<match_mode Mode, std::size_t N, typename Inner>
+    requires (!is_trivially_matchable<basic_fixed_repetition<Mode, N, Inner>>)
+    inline constexpr bool is_fixed_width_matchable<basic_fixed_repetition<Mode, N, Inner>> = is_fixed_width_matchable<Inner>;
+
+    /**
+     * Matches fixed width AST nodes without continuations.
+     * Each match function advances the given iterator past the matched characters.
+     *
+     * @note The caller must ensure that there are at least min_width<Node> characters left in the input.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    struct fixed_width_matcher
+    {
+        template<std::forward_iterator Iter, typename Context>
+        static constexpr bool match(Iter &current, Context &ctx) noexcept
+        {
+            return Node::match_one(*current++, ctx);
+        }
+    };
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<sequence<Nodes ...>>)
+    struct fixed_width_matcher<sequence<Nodes ...>>
+    {
+        template<std::forward_iterator Iter, typename Context>
+        static constexpr bool match(Iter &current, Context &ctx) noexcept
+        {
+            return (fixed_width_matcher<Nodes>::match(current, ctx) && ...);
+        }
+    };
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<alternation<Nodes ...>>)
+    struct fixed_width_matcher<alternation<Nodes ...>>
+    {
+        template<std::forward_iterator Iter, typename Context>
+        static constexpr bool match(Iter &current, Context &ctx) noexcept
+        {
+            // All branches have the same width, so any matching branch ends at the same position
+            Iter const start = current;
+            return ((current = start, fixed_width_matcher<Nodes>::match(current, ctx)) || ...);
+        }
+    };
+
+    template<match_mode Mode, std::size_t N, typename Inner>
+    requires (!is_trivially_matchable<basic_fixed_repetition<Mode, N, Inner>>)
+    struct fixed_width_matcher<basic_fixed_repetition<Mode, N, Inner>>
+    {
+        template<std::forward_iterator Iter, typename Context>
+        static constexpr bool match(Iter &current, Context &ctx) noexcept
+        {
+            for (std::size_t match_count = 0; match_count != N; ++match_count)
+            {
+                if (!fixed_width_matcher<Inner>::match(current, ctx))
+                    return false;
+            }
+            return true;
+        }
+    };
+}
+#endif //MREGEX_AST_FIXED_WIDTH_HPP
@@ -1,13 +1,121 @@
 #ifndef MREGEX_NODES_ALTERNATION_HPP
 #define MREGEX_NODES_ALTERNATION_HPP
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 #include <mregex/ast/nodes/set.hpp>
+#include <mregex/ast/first_set.hpp>
 #include <mregex/ast/match_result.hpp>
 #include <mregex/ast/traits.hpp>
+#include <mregex/utility/char_set.hpp>
 #include <mregex/utility/continuations.hpp>
 
 namespace meta::ast
 {
+    namespace detail
+    {
+        template<typename Index, std::size_t N>
+        constexpr auto make_branch_indices(std::array<char_set, N> const &start_sets) noexcept
+        {
+            constexpr auto ambiguous = static_cast<Index>(N);
+            constexpr auto none = static_cast<Index>(N + 1);
+
+            std::array<Index, char_set::size> indices{};
+            for (std::size_t byte = 0; byte != char_set::size; ++byte)
+            {
+                auto const input = static_cast<char>(byte);
+                indices[byte] = none;
+                for (std::size_t branch = 0; branch != N; ++branch)
+                {
+                    if (!start_sets[branch].contains(input))
+                        continue;
+                    indices[byte] = indices[byte] == none ? static_cast<Index>(branch) : ambiguous;
+                }
+            }
+            return indices;
+        }
+
+        template<typename Index, std::size_t N>
+        constexpr bool has_unambiguous_entries(std::array<Index, char_set::size> const &indices) noexcept
+        {
+            for (auto index : indices)
+            {
+                if (index != static_cast<Index>(N))
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * Lookup table that maps each input character to the only alternation branch
+         * which can start matching with it.
+         *
+         * @tparam Flags    The flags used for matching
+         * @tparam Branches The alternation branches
+         */
+        template<typename Flags, typename... Branches>
+        struct branch_dispatch_table
+        {
+            static constexpr std::size_t branch_count = sizeof...(Branches);
+
+            using index_type = std::conditional_t<(branch_count + 1 < UINT8_MAX), std::uint8_t, std::size_t>;
+
+            static constexpr auto ambiguous = static_cast<index_type>(branch_count);
+            static constexpr auto none = static_cast<index_type>(branch_count + 1);
+
+            static constexpr std::array<char_set, branch_count> start_sets{start_set<Branches, Flags> ...};
+            static constexpr auto indices = make_branch_indices<index_type>(start_sets);
+
+            // If all characters are ambiguous, ordered matching does the same work without the lookup
+            static constexpr bool is_useful = has_unambiguous_entries<index_type, branch_count>(indices);
+        };
+
+        template<typename... Branches>
+        struct branch_dispatcher
+        {
+            template<typename Table, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+            static constexpr auto match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+            -> match_result<Iter>
+            {
+                return match(begin, end, current, ctx, cont, Table{}, std::index_sequence_for<Branches ...>{});
+            }
+
+        private:
+            template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont, typename Table, std::size_t... Indices>
+            static constexpr auto match(
+                    Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont,
+                    Table, std::index_sequence<Indices ...>
+            ) noexcept -> match_result<Iter>
+            {
+                char const input = *current;
+                auto const index = Table::indices[static_cast<std::uint8_t>(input)];
+                auto result = non_match(current);
+                if (index == Table::none)
+                    return result;
+                if (index != Table::ambiguous)
+                {
+                    ((Indices == index && (result = Branches::match(begin, end, current, ctx, cont), true)) || ...);
+                    return result;
+                }
+                // Overlapping branches are tried in order, skipping the ones that cannot start here
+                (
+                    (
+                        Table::start_sets[Indices].contains(input) &&
+                        (result = Branches::match(begin, end, current, ctx, cont))
+                    ) || ...
+                );
+                return result;
+            }
+        };
+    }
+
+    /**
+     * @note When the branches start with different characters, the branch to be tried is
+     * selected with a lookup table indexed by the current input character, instead of
+     * trying all branches in order.
+     */
     template<typename First, typename... Rest>
     struct alternation
     {
@@ -15,6 +123,13 @@ namespace meta::ast
         static constexpr auto match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
         {
+            using dispatch_table = detail::branch_dispatch_table<typename Context::flags, First, Rest ...>;
+
+            if constexpr (dispatch_table::is_useful)
+            {
+                if (current != end)
+                    return detail::branch_dispatcher<First, Rest ...>::template match<dispatch_table>(begin, end, current, ctx, cont);
+            }
             if (auto first_match = First::match(begin, end, current, ctx, cont))
                 return first_match;
             return alternation<Rest ...>::match(begin, end, current, ctx, cont);
@@ -28,4 +143,4 @@ namespace meta::ast
     template<typename Inner>
     struct alternation<Inner> : Inner {};
 }
-#endif //MREGEX_NODES_ALTERNATION_HPP
\ No newline at end of file
+#endif //MREGEX_NODES_ALTERNATION_HPP
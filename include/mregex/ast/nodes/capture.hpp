@@ -9,6 +9,12 @@
 
 namespace meta::ast
 {
+    namespace detail
+    {
+        template<typename Inner>
+        struct fixed_width_loop;
+    }
+
     /**
      * @note Since matching captures implies side effects like storing and clearing matched
      * content, they cannot be considered trivially matchable even when the inner node is.
@@ -20,17 +26,17 @@ namespace meta::ast
         static constexpr auto match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
         {
-            auto continuation = [=, &ctx, &cont](Iter next) noexcept -> match_result<Iter> {
-                capture_matched_range(current, next, ctx);
-                return cont(next);
-            };
-            if (auto inner_match = Inner::match(begin, end, current, ctx, continuation))
-                return inner_match;
-            get_group<ID>(ctx.captures).clear();
-            return non_match(current);
+            if constexpr (is_deferred<Context>)
+                return deferred_match(begin, end, current, ctx, cont);
+            else
+                return eager_match(begin, end, current, ctx, cont);
         }
 
     private:
+        // Fixed width loops store the last iteration of the capture without matching it again
+        template<typename>
+        friend struct detail::fixed_width_loop;
+
         template<std::forward_iterator Iter, typename Context>
         static constexpr auto capture_matched_range(Iter begin, Iter end, Context &ctx) noexcept
         {
@@ -42,6 +48,41 @@ namespace meta::ast
                 get_group<ID>(ctx.captures) = capture_view_type{begin, end};
             else
                 get_group<ID>(ctx.captures) = capture_view_type{end.base(), begin.base()};
+            ctx.template mark_capture<ID>();
+        }
+
+        template<typename Context>
+        static constexpr bool is_deferred = requires { requires Context::template is_deferred_capture<ID>; };
+
+        /**
+         * Stores the captured content only after the rest of the regex matched.
+         * Paths that fail do not touch the capture, so there is nothing to clear.
+         */
+        template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto deferred_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        {
+            auto continuation = [=, &ctx, &cont](Iter next) noexcept -> match_result<Iter> {
+                auto rest_match = cont(next);
+                if (rest_match)
+                    capture_matched_range(current, next, ctx);
+                return rest_match;
+            };
+            return Inner::match(begin, end, current, ctx, continuation);
+        }
+
+        template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto eager_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        {
+            auto continuation = [=, &ctx, &cont](Iter next) noexcept -> match_result<Iter> {
+                capture_matched_range(current, next, ctx);
+                return cont(next);
+            };
+            if (auto inner_match = Inner::match(begin, end, current, ctx, continuation))
+                return inner_match;
+            get_group<ID>(ctx.captures).clear();
+            return non_match(current);
         }
     };
 }
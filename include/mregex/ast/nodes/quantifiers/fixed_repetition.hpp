@@ -2,6 +2,8 @@
 #define MREGEX_NODES_FIXED_REPETITION_HPP
 
 #include <mregex/ast/nodes/terminals/empty.hpp>
+#include <mregex/ast/determinism.hpp>
+#include <mregex/ast/fixed_width.hpp>
 #include <mregex/ast/match_result.hpp>
 #include <mregex/ast/traits.hpp>
 #include <mregex/utility/continuations.hpp>
@@ -57,6 +59,37 @@ namespace meta::ast
                 return non_unrolled_trivial_match(current, ctx, cont);
         }
 
+        template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto backtracking_match(Iter /*begin*/, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires (!is_trivially_matchable<Inner> && is_fixed_width_matchable<Inner>)
+        {
+            constexpr auto width = static_cast<std::ptrdiff_t>(min_width<basic_repetition>);
+
+            if (distance_less_than<width>(current, end))
+                return non_match(current);
+            if (Iter next = current; fixed_width_matcher<basic_repetition>::match(next, ctx))
+                return cont(next);
+            return non_match(current);
+        }
+
+        template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto backtracking_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires (!is_fixed_width_matchable<Inner> && is_deterministic<Inner> && capture_count<Inner> == 0)
+        {
+            // Each iteration can only end in one position, so there is nothing to backtrack into
+            Iter const initial = current;
+            for (std::size_t match_count = 0; match_count != N; ++match_count)
+            {
+                auto inner_match = Inner::match(begin, end, current, ctx, continuations<Iter>::success);
+                if (!inner_match)
+                    return non_match(initial);
+                current = inner_match.end;
+            }
+            return cont(current);
+        }
+
         template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
         static constexpr auto unrolled_backtracking_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
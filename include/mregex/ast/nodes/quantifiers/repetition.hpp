@@ -1,19 +1,116 @@
 #ifndef MREGEX_NODES_REPETITION_HPP
 #define MREGEX_NODES_REPETITION_HPP
 
+#include <mregex/ast/nodes/capture.hpp>
 #include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/determinism.hpp>
+#include <mregex/ast/fixed_width.hpp>
 #include <mregex/ast/match_result.hpp>
 #include <mregex/ast/traits.hpp>
 #include <mregex/utility/continuations.hpp>
+#include <mregex/utility/distance.hpp>
 
 namespace meta::ast
 {
+    namespace detail
+    {
+        /**
+         * Describes how a repeated node is matched by a fixed width loop.
+         * A capture around a fixed width node is supported by storing only the last iteration,
+         * since its content is not needed inside the loop.
+         *
+         * @tparam Inner    The repeated AST node
+         */
+        template<typename Inner>
+        struct fixed_width_loop
+        {
+            using body_type = Inner;
+
+            static constexpr bool is_capturing = false;
+
+            template<typename Context>
+            static constexpr auto save(Context &) noexcept
+            {
+                return nullptr;
+            }
+
+            template<std::forward_iterator Iter, typename Context>
+            static constexpr void update(Iter /*initial*/, Iter /*next*/, Context &, std::nullptr_t) noexcept {}
+        };
+
+        template<std::size_t ID, typename Name, typename Inner>
+        struct fixed_width_loop<capture<ID, Name, Inner>>
+        {
+            using body_type = Inner;
+
+            static constexpr bool is_capturing = true;
+
+            template<typename Context>
+            static constexpr auto save(Context &ctx) noexcept
+            {
+                return get_group<ID>(ctx.captures);
+            }
+
+            /**
+             * Stores the last iteration that ends at the given position.
+             * If there were no iterations, the capture is restored to its saved state.
+             */
+            template<std::bidirectional_iterator Iter, typename Context, typename Saved>
+            static constexpr void update(Iter initial, Iter next, Context &ctx, Saved const &saved) noexcept
+            {
+                if (next == initial)
+                    get_group<ID>(ctx.captures) = saved;
+                else
+                    capture<ID, Name, Inner>::capture_matched_range(std::prev(next, min_width<Inner>), next, ctx);
+            }
+        };
+    }
+
     template<match_mode Mode, symbol::finite_quantifier LowerBound, symbol::quantifier UpperBound, typename Inner>
     struct basic_repetition
     {
         static_assert(symbol::is_valid_range<LowerBound, UpperBound>, "invalid range bounds");
         static_assert(!std::is_same_v<LowerBound, UpperBound>, "this implementation does not handle fixed repetitions");
 
+    private:
+        using loop_type = detail::fixed_width_loop<Inner>;
+        using loop_body_type = typename loop_type::body_type;
+
+        static constexpr std::ptrdiff_t loop_stride = min_width<loop_body_type>;
+
+        /**
+         * Inner nodes made only of trivially matchable parts with a fixed, non-zero width
+         * are repeated in a loop instead of a chain of continuations.
+         */
+        template<typename Iter>
+        static constexpr bool has_fixed_width_loop =
+                !is_trivially_matchable<Inner> &&
+                is_fixed_width_matchable<loop_body_type> &&
+                loop_stride != 0 &&
+                (!loop_type::is_capturing || std::bidirectional_iterator<Iter>);
+
+        /**
+         * Other inner nodes that can only end in one position are repeated in a loop as well.
+         * Greedy repetitions save the end of each iteration on an explicit stack owned by the context,
+         * which makes the depth of the call stack independent of the number of iterations.
+         *
+         * @note Inner nodes which can backtrack internally or contain captures are still repeated
+         * with one nested continuation per iteration, so the call stack grows with the number of iterations.
+         */
+        template<typename Iter>
+        static constexpr bool has_deterministic_loop =
+                !is_trivially_matchable<Inner> &&
+                !has_fixed_width_loop<Iter> &&
+                is_deterministic<Inner> &&
+                capture_count<Inner> == 0;
+
+        template<typename Iter, typename Context>
+        static constexpr bool has_explicit_stack_loop =
+                has_deterministic_loop<Iter> &&
+                std::is_same_v<Iter, typename Context::iterator>;
+
+    public:
+
         template<std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
         static constexpr auto match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
@@ -75,6 +172,21 @@ namespace meta::ast
             return cont(current);
         }
 
+        template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto bounded_possessive_match(Iter /*begin*/, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires has_fixed_width_loop<Iter>
+        {
+            auto const saved = loop_type::save(ctx);
+            Iter const initial = current;
+            current = fixed_width_scan<Bound>(end, current, ctx);
+            loop_type::update(initial, current, ctx, saved);
+            auto rest_match = cont(current);
+            if (!rest_match)
+                loop_type::update(initial, initial, ctx, saved);
+            return rest_match;
+        }
+
         template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
         static constexpr auto bounded_greedy_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
@@ -109,6 +221,55 @@ namespace meta::ast
             return bounded_possessive_match<Bound>(begin, end, current, ctx, continuation);
         }
 
+        template<symbol::quantifier Bound, std::bidirectional_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto bounded_greedy_match(Iter /*begin*/, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires has_fixed_width_loop<Iter>
+        {
+            auto const saved = loop_type::save(ctx);
+            Iter const initial = current;
+            Iter next = fixed_width_scan<Bound>(end, current, ctx);
+            while (true)
+            {
+                loop_type::update(initial, next, ctx, saved);
+                if (auto rest_match = cont(next))
+                    return rest_match;
+                if (next == initial)
+                    break;
+                std::advance(next, -loop_stride);
+            }
+            return non_match(initial);
+        }
+
+        template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto bounded_greedy_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires has_explicit_stack_loop<Iter, Context>
+        {
+            auto &positions = ctx.backtrack_positions;
+            std::size_t const base = positions.size();
+            for (std::size_t match_count = 0; !symbol::equals<Bound>(match_count); ++match_count)
+            {
+                auto inner_match = Inner::match(begin, end, current, ctx, continuations<Iter>::success);
+                if (!inner_match || will_loop_forever(current, inner_match.end))
+                    break;
+                positions.push(current);
+                current = inner_match.end;
+            }
+            while (true)
+            {
+                if (auto rest_match = cont(current))
+                {
+                    positions.shrink_to(base);
+                    return rest_match;
+                }
+                if (positions.size() == base)
+                    break;
+                current = positions.pop();
+            }
+            return non_match(current);
+        }
+
         template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
         static constexpr auto bounded_lazy_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
         -> match_result<Iter>
@@ -140,6 +301,61 @@ namespace meta::ast
             return non_match(current);
         }
 
+        template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto bounded_lazy_match(Iter /*begin*/, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires has_fixed_width_loop<Iter>
+        {
+            auto const saved = loop_type::save(ctx);
+            Iter const initial = current;
+            for (std::size_t match_count = 0;; ++match_count)
+            {
+                loop_type::update(initial, current, ctx, saved);
+                if (auto rest_match = cont(current))
+                    return rest_match;
+                if (symbol::equals<Bound>(match_count) || distance_less_than<loop_stride>(current, end))
+                    break;
+                if (!fixed_width_matcher<loop_body_type>::match(current, ctx))
+                    break;
+            }
+            loop_type::update(initial, initial, ctx, saved);
+            return non_match(initial);
+        }
+
+        template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context, match_continuation<Iter> Cont>
+        static constexpr auto bounded_lazy_match(Iter begin, Iter end, Iter current, Context &ctx, Cont &&cont) noexcept
+        -> match_result<Iter>
+        requires has_deterministic_loop<Iter>
+        {
+            for (std::size_t match_count = 0;; ++match_count)
+            {
+                if (auto rest_match = cont(current))
+                    return rest_match;
+                if (symbol::equals<Bound>(match_count))
+                    break;
+                auto inner_match = Inner::match(begin, end, current, ctx, continuations<Iter>::success);
+                if (!inner_match || will_loop_forever(current, inner_match.end))
+                    break;
+                current = inner_match.end;
+            }
+            return non_match(current);
+        }
+
+        template<symbol::quantifier Bound, std::forward_iterator Iter, typename Context>
+        static constexpr Iter fixed_width_scan(Iter end, Iter current, Context &ctx) noexcept
+        {
+            for (std::size_t match_count = 0; !symbol::equals<Bound>(match_count); ++match_count)
+            {
+                if (distance_less_than<loop_stride>(current, end))
+                    break;
+                Iter next = current;
+                if (!fixed_width_matcher<loop_body_type>::match(next, ctx))
+                    break;
+                current = next;
+            }
+            return current;
+        }
+
         template<std::forward_iterator Iter, match_continuation<Iter> Cont>
         static constexpr auto continue_unless_infinite_loop(Iter current, Cont &&cont) noexcept
         {
@@ -12,7 +12,7 @@ namespace meta::ast
         static_assert(are_trivially_matchable<Nodes ...>, "only trivially matchable AST nodes can form a set");
 
         template<typename Context>
-        static constexpr bool match_one(char input, Context &ctx) noexcept
+        static constexpr bool match_one([[maybe_unused]] char input, [[maybe_unused]] Context &ctx) noexcept
         {
             return (Nodes::match_one(input, ctx) || ...);
         }
@@ -0,0 +1,68 @@
+#ifndef MREGEX_AST_OPTIMIZATION_HPP
+#define MREGEX_AST_OPTIMIZATION_HPP
+
+#include <mregex/ast/passes/auto_possessification.hpp>
+#include <mregex/ast/passes/empty_removal.hpp>
+#include <mregex/ast/passes/flattening.hpp>
+#include <mregex/ast/passes/prefix_factoring.hpp>
+#include <mregex/ast/passes/repetition_folding.hpp>
+#include <mregex/ast/passes/set_normalization.hpp>
+#include <mregex/ast/passes/trivial_run_merging.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename Node, template<typename> typename... Passes>
+        struct apply_passes
+        {
+            using type = Node;
+        };
+
+        template<typename Node, template<typename> typename First, template<typename> typename... Rest>
+        struct apply_passes<Node, First, Rest ...>
+        {
+            using type = typename apply_passes<typename First<Node>::type, Rest ...>::type;
+        };
+    }
+
+    /**
+     * Metacontainer for an ordered list of optimization passes.
+     * Each pass is a metafunction that maps an AST to a semantically equivalent AST,
+     * in the same way as ast::transform. The passes are applied from left to right.
+     *
+     * @tparam Passes   The optimization passes
+     */
+    template<template<typename> typename... Passes>
+    struct pass_pipeline
+    {
+        template<typename Node>
+        using apply_t = typename detail::apply_passes<Node, Passes ...>::type;
+    };
+
+    /**
+     * The pipeline of passes used to optimize the AST of every regex before matching.
+     */
+    using default_pipeline = pass_pipeline
+    <
+        fold_repetitions,
+        remove_empty,
+        flatten,
+        factor_prefixes,
+        flatten,
+        normalize_sets,
+        auto_possessify,
+        merge_trivial_runs
+    >;
+
+    /**
+     * Metafunction that optimizes an AST by running it through the default pipeline.
+     * The resulting AST is simplified and has a canonical form, but it matches exactly
+     * the same inputs and has the same capturing groups as the original one.
+     *
+     * @tparam Node The AST node type being optimized
+     */
+    template<typename Node>
+    using optimize_t = default_pipeline::apply_t<Node>;
+}
+#endif //MREGEX_AST_OPTIMIZATION_HPP
@@ -0,0 +1,106 @@
+#ifndef MREGEX_PASSES_AUTO_POSSESSIFICATION_HPP
+#define MREGEX_PASSES_AUTO_POSSESSIFICATION_HPP
+
+#include <type_traits>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/first_set.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        /**
+         * Checks if a repetition can never give back characters in a successful match.
+         * This is the case when the nodes that follow it must start with a character that
+         * the repetition cannot consume, so backtracking into the repetition is useless.
+         *
+         * @tparam Inner    The trivially matchable node being repeated
+         * @tparam Follow   A type sequence with the nodes that follow the repetition,
+         *                  or an empty sequence if they are unknown
+         */
+        template<typename Inner, typename Follow>
+        inline constexpr bool has_disjoint_follow = false;
+
+        template<typename Inner, typename... Follow>
+        requires (sizeof...(Follow) > 0)
+        inline constexpr bool has_disjoint_follow<Inner, type_sequence<Follow ...>> =
+                !any_flags_first_set<sequence<Follow ...>>::nullable &&
+                !any_flags_first_set<Inner>::chars.intersects(any_flags_first_set<sequence<Follow ...>>::chars);
+
+        template<typename Node, typename Follow>
+        struct possessify
+        {
+            using type = Node;
+        };
+
+        template<typename Node, typename Follow>
+        using possessify_t = typename possessify<Node, Follow>::type;
+
+        template<typename Follow, typename... Nodes>
+        struct possessify_elements
+        {
+            using type = type_sequence<>;
+        };
+
+        template<typename Follow, typename First, typename... Rest>
+        struct possessify_elements<Follow, First, Rest ...>
+        {
+            using first_type = possessify_t<First, concat_t<type_sequence<Rest ...>, Follow>>;
+            using type = push_t<typename possessify_elements<Follow, Rest ...>::type, first_type>;
+        };
+
+        template<typename... Nodes, typename Follow>
+        struct possessify<sequence<Nodes ...>, Follow>
+        {
+            using type = unpack_t<sequence, typename possessify_elements<Follow, Nodes ...>::type>;
+        };
+
+        template<typename... Nodes, typename Follow>
+        struct possessify<alternation<Nodes ...>, Follow>
+        {
+            using type = alternation<possessify_t<Nodes, Follow> ...>;
+        };
+
+        template<std::size_t ID, typename Name, typename Inner, typename Follow>
+        struct possessify<capture<ID, Name, Inner>, Follow>
+        {
+            using type = capture<ID, Name, possessify_t<Inner, Follow>>;
+        };
+
+        template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner, typename Follow>
+        struct possessify<basic_repetition<Mode, A, B, Inner>, Follow>
+        {
+            // Another iteration might follow the inner node, so its follow set is unknown
+            using inner_type = possessify_t<Inner, type_sequence<>>;
+
+            static constexpr bool can_possessify =
+                    Mode != match_mode::possessive &&
+                    !std::is_same_v<A, B> &&
+                    is_trivially_matchable<inner_type> &&
+                    has_disjoint_follow<inner_type, Follow>;
+
+            static constexpr match_mode mode = can_possessify ? match_mode::possessive : Mode;
+
+            using type = basic_repetition<mode, A, B, inner_type>;
+        };
+    }
+
+    /**
+     * Optimization pass that makes repetitions possessive when backtracking into them cannot
+     * lead to a match. For example, \d+- becomes \d++-, since no digit can start the match of -.
+     *
+     * @note Only repetitions of trivially matchable nodes are considered, and only when
+     * the nodes following them are known and cannot match the empty string.
+     * Lookarounds are left unchanged, since lookbehinds are matched in the opposite direction.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct auto_possessify : detail::possessify<Node, type_sequence<>> {};
+
+    template<typename Node>
+    using auto_possessify_t = typename auto_possessify<Node>::type;
+}
+#endif //MREGEX_PASSES_AUTO_POSSESSIFICATION_HPP
@@ -0,0 +1,48 @@
+#ifndef MREGEX_PASSES_CAPTURE_STRIPPING_HPP
+#define MREGEX_PASSES_CAPTURE_STRIPPING_HPP
+
+#include <type_traits>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename BackrefSpec>
+        struct capture_stripper
+        {
+            template<typename Node>
+            struct apply : transform<Node, apply> {};
+
+            template<std::size_t ID, typename Name, typename Inner>
+            struct apply<capture<ID, Name, Inner>>
+            {
+                static constexpr bool is_referenced =
+                        contains<BackrefSpec, std::integral_constant<std::size_t, ID>> ||
+                        contains<BackrefSpec, Name>;
+
+                using inner_type = typename apply<Inner>::type;
+                using type = std::conditional_t<is_referenced, capture<ID, Name, inner_type>, inner_type>;
+            };
+        };
+    }
+
+    /**
+     * Pass that replaces capturing groups by their inner nodes, unless they are needed
+     * by a backreference. Captures which are kept retain their original IDs.
+     *
+     * @note Unlike optimization passes, this pass changes the capturing groups of the AST.
+     * It is meant for matching when only a boolean answer is needed.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct strip_captures : detail::capture_stripper<backref_spec_t<Node>>::template apply<Node> {};
+
+    template<typename Node>
+    using strip_captures_t = typename strip_captures<Node>::type;
+}
+#endif //MREGEX_PASSES_CAPTURE_STRIPPING_HPP
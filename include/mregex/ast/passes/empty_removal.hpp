@@ -0,0 +1,44 @@
+#ifndef MREGEX_PASSES_EMPTY_REMOVAL_HPP
+#define MREGEX_PASSES_EMPTY_REMOVAL_HPP
+
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename Node>
+        struct non_empty
+        {
+            using type = type_sequence<Node>;
+        };
+
+        template<>
+        struct non_empty<empty>
+        {
+            using type = type_sequence<>;
+        };
+    }
+
+    /**
+     * Optimization pass that removes empty nodes from sequences.
+     * An empty node always matches without consuming input, so it has no effect inside a sequence.
+     * A sequence which contains only empty nodes is replaced by a single empty node.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct remove_empty : transform<Node, remove_empty> {};
+
+    template<typename Node>
+    using remove_empty_t = typename remove_empty<Node>::type;
+
+    template<typename... Nodes>
+    struct remove_empty<sequence<Nodes ...>>
+    {
+        using type = pack_nodes_t<sequence, concat_t<typename detail::non_empty<remove_empty_t<Nodes>>::type ...>>;
+    };
+}
+#endif //MREGEX_PASSES_EMPTY_REMOVAL_HPP
@@ -0,0 +1,56 @@
+#ifndef MREGEX_PASSES_FLATTENING_HPP
+#define MREGEX_PASSES_FLATTENING_HPP
+
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<template<typename...> typename Wrapper, typename Node>
+        struct elements_of
+        {
+            using type = type_sequence<Node>;
+        };
+
+        template<template<typename...> typename Wrapper, typename... Nodes>
+        struct elements_of<Wrapper, Wrapper<Nodes ...>>
+        {
+            using type = type_sequence<Nodes ...>;
+        };
+
+        template<template<typename...> typename Wrapper, typename Node>
+        using elements_of_t = typename elements_of<Wrapper, Node>::type;
+
+        template<template<typename...> typename Wrapper, typename... Nodes>
+        using flat_pack_t = pack_nodes_t<Wrapper, concat_t<elements_of_t<Wrapper, Nodes> ...>>;
+    }
+
+    /**
+     * Optimization pass that flattens nested sequences and alternations.
+     * Since both operators are associative, their nested instances can be merged
+     * into the parent node without changing the order in which nodes are matched.
+     *
+     * @tparam Node The AST node type being flattened
+     */
+    template<typename Node>
+    struct flatten : transform<Node, flatten> {};
+
+    template<typename Node>
+    using flatten_t = typename flatten<Node>::type;
+
+    template<typename... Nodes>
+    struct flatten<sequence<Nodes ...>>
+    {
+        using type = detail::flat_pack_t<sequence, flatten_t<Nodes> ...>;
+    };
+
+    template<typename... Nodes>
+    struct flatten<alternation<Nodes ...>>
+    {
+        using type = detail::flat_pack_t<alternation, flatten_t<Nodes> ...>;
+    };
+}
+#endif //MREGEX_PASSES_FLATTENING_HPP
@@ -0,0 +1,104 @@
+#ifndef MREGEX_PASSES_PREFIX_FACTORING_HPP
+#define MREGEX_PASSES_PREFIX_FACTORING_HPP
+
+#include <type_traits>
+#include <mregex/ast/passes/flattening.hpp>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename... Branches>
+        struct factor_alternation;
+
+        template<typename... Branches>
+        using factor_alternation_t = typename factor_alternation<Branches ...>::type;
+
+        /**
+         * Packs a group of consecutive branches which start with the same node.
+         * Each branch is given as a type sequence with the nodes it contains.
+         */
+        template<typename... Group>
+        struct pack_branch_group
+        {
+            using head_type = front_t<front_t<type_sequence<Group ...>>>;
+            using tails_type = factor_alternation_t<pack_nodes_t<sequence, pop_t<Group>> ...>;
+            using type = type_sequence<sequence<head_type, tails_type>>;
+        };
+
+        template<typename Branch>
+        struct pack_branch_group<Branch>
+        {
+            using type = type_sequence<pack_nodes_t<sequence, Branch>>;
+        };
+
+        template<>
+        struct pack_branch_group<>
+        {
+            using type = type_sequence<>;
+        };
+
+        template<typename Group>
+        using pack_branch_group_t = typename unpack_t<pack_branch_group, Group>::type;
+
+        template<typename Branch, typename Group>
+        inline constexpr bool shares_head = std::is_same_v<front_t<Branch>, front_t<front_t<Group>>> && is_trivially_matchable<front_t<Branch>>;
+
+        template<typename Result, typename Group, typename... Branches>
+        struct group_branches
+        {
+            using type = concat_t<Result, pack_branch_group_t<Group>>;
+        };
+
+        template<typename Result, typename Group, typename First, typename... Rest>
+        struct group_branches<Result, Group, First, Rest ...>
+        {
+            using next_result = concat_t<Result, pack_branch_group_t<Group>>;
+            using type = typename group_branches<next_result, type_sequence<First>, Rest ...>::type;
+        };
+
+        template<typename Result, typename... Group, typename First, typename... Rest>
+        requires (sizeof...(Group) > 0) && shares_head<First, type_sequence<Group ...>>
+        struct group_branches<Result, type_sequence<Group ...>, First, Rest ...>
+        {
+            using type = typename group_branches<Result, type_sequence<Group ..., First>, Rest ...>::type;
+        };
+
+        template<typename... Branches>
+        struct factor_alternation
+        {
+            using branches = typename group_branches<type_sequence<>, type_sequence<>, elements_of_t<sequence, Branches> ...>::type;
+            using type = pack_nodes_t<alternation, branches>;
+        };
+    }
+
+    /**
+     * Optimization pass that factors out common prefixes of consecutive alternation branches.
+     * For example, (?:ab|ac|d) becomes (?:a(?:b|c)|d), which turns alternations of keywords
+     * into trie-shaped trees that never scan a shared prefix more than once.
+     *
+     * @note Only trivially matchable prefixes are factored. They can be matched in exactly one way,
+     * so the factored alternation tries the remaining parts of the branches in the same order
+     * as the original one. Branches are never reordered.
+     *
+     * @note This pass expects flat sequences and alternations.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct factor_prefixes : transform<Node, factor_prefixes> {};
+
+    template<typename Node>
+    using factor_prefixes_t = typename factor_prefixes<Node>::type;
+
+    template<typename... Nodes>
+    struct factor_prefixes<alternation<Nodes ...>>
+    {
+        using type = detail::factor_alternation_t<factor_prefixes_t<Nodes> ...>;
+    };
+}
+#endif //MREGEX_PASSES_PREFIX_FACTORING_HPP
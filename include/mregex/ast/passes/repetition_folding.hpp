@@ -0,0 +1,85 @@
+#ifndef MREGEX_PASSES_REPETITION_FOLDING_HPP
+#define MREGEX_PASSES_REPETITION_FOLDING_HPP
+
+#include <type_traits>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/ast/transform.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename Node>
+        inline constexpr bool is_fixed_repetition = false;
+
+        template<match_mode Mode, std::size_t N, typename Inner>
+        inline constexpr bool is_fixed_repetition<basic_fixed_repetition<Mode, N, Inner>> = N > 1;
+
+        template<typename Node>
+        struct fixed_repetition_traits;
+
+        template<match_mode Mode, std::size_t N, typename Inner>
+        struct fixed_repetition_traits<basic_fixed_repetition<Mode, N, Inner>>
+        {
+            static constexpr match_mode mode = Mode;
+            static constexpr std::size_t count = N;
+
+            using inner_type = Inner;
+        };
+
+        template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+        constexpr auto fold_repetition() noexcept
+        {
+            if constexpr (std::is_same_v<Inner, empty>)
+                return std::type_identity<empty>{};
+            else if constexpr (std::is_same_v<A, B> && symbol::is_zero<A> && capture_count<Inner> == 0)
+                return std::type_identity<empty>{};
+            else if constexpr (std::is_same_v<A, B> && symbol::equals<A>(1))
+            {
+                // Atomic groups can only be removed if they contain nothing to backtrack into
+                if constexpr (Mode != match_mode::possessive || is_trivially_matchable<Inner>)
+                    return std::type_identity<Inner>{};
+                else
+                    return std::type_identity<basic_repetition<Mode, A, B, Inner>>{};
+            }
+            else if constexpr (std::is_same_v<A, B> && !symbol::is_zero<A> && is_fixed_repetition<Inner>)
+            {
+                using inner_traits = fixed_repetition_traits<Inner>;
+                using inner_type = typename inner_traits::inner_type;
+
+                // Folding would make the inner possessive repetitions lose their atomicity
+                constexpr bool can_fold = inner_traits::mode != match_mode::possessive || is_trivially_matchable<inner_type>;
+                constexpr std::size_t count = symbol::get_value<A> * inner_traits::count;
+
+                if constexpr (can_fold)
+                    return std::type_identity<basic_fixed_repetition<Mode, count, inner_type>>{};
+                else
+                    return std::type_identity<basic_repetition<Mode, A, B, Inner>>{};
+            }
+            else
+                return std::type_identity<basic_repetition<Mode, A, B, Inner>>{};
+        }
+    }
+
+    /**
+     * Optimization pass that simplifies repetitions.
+     * Nested fixed repetitions like (?:x{2}){3} are folded into a single repetition (x{6}),
+     * trivial repetitions like x{1} are replaced by their inner node and repetitions
+     * which can only match the empty string are replaced by ast::empty.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct fold_repetitions : transform<Node, fold_repetitions> {};
+
+    template<typename Node>
+    using fold_repetitions_t = typename fold_repetitions<Node>::type;
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    struct fold_repetitions<basic_repetition<Mode, A, B, Inner>>
+    {
+        using type = typename decltype(detail::fold_repetition<Mode, A, B, fold_repetitions_t<Inner>>())::type;
+    };
+}
+#endif //MREGEX_PASSES_REPETITION_FOLDING_HPP
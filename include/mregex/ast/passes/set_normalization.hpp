@@ -0,0 +1,56 @@
+#ifndef MREGEX_PASSES_SET_NORMALIZATION_HPP
+#define MREGEX_PASSES_SET_NORMALIZATION_HPP
+
+#include <type_traits>
+#include <mregex/ast/passes/flattening.hpp>
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename... Nodes>
+        using normalized_set_t = pack_nodes_t<set, unique_t<concat_t<elements_of_t<set, Nodes> ...>>>;
+    }
+
+    /**
+     * Optimization pass that brings sets into a canonical form.
+     * Nested sets are merged into their parent, duplicate elements are removed and
+     * sets with a single element are replaced by that element. Alternations of trivially
+     * matchable nodes are converted into sets, since the two are equivalent.
+     *
+     * @tparam Node The AST node type being normalized
+     */
+    template<typename Node>
+    struct normalize_sets : transform<Node, normalize_sets> {};
+
+    template<typename Node>
+    using normalize_sets_t = typename normalize_sets<Node>::type;
+
+    template<typename... Nodes>
+    struct normalize_sets<set<Nodes ...>>
+    {
+        using type = detail::normalized_set_t<normalize_sets_t<Nodes> ...>;
+    };
+
+    template<typename... Nodes>
+    struct normalize_sets<alternation<Nodes ...>>
+    {
+        using type = std::conditional_t
+        <
+            are_trivially_matchable<normalize_sets_t<Nodes> ...>,
+            detail::normalized_set_t<normalize_sets_t<Nodes> ...>,
+            alternation<normalize_sets_t<Nodes> ...>
+        >;
+    };
+
+    template<typename Inner>
+    struct normalize_sets<negated<negated<Inner>>>
+    {
+        using type = normalize_sets_t<Inner>;
+    };
+}
+#endif //MREGEX_PASSES_SET_NORMALIZATION_HPP
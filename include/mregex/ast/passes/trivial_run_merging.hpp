@@ -0,0 +1,73 @@
+#ifndef MREGEX_PASSES_TRIVIAL_RUN_MERGING_HPP
+#define MREGEX_PASSES_TRIVIAL_RUN_MERGING_HPP
+
+#include <mregex/ast/astfwd.hpp>
+#include <mregex/ast/traits.hpp>
+#include <mregex/ast/transform.hpp>
+#include <mregex/utility/type_sequence.hpp>
+
+namespace meta::ast
+{
+    namespace detail
+    {
+        template<typename Run>
+        struct flush_run
+        {
+            using type = type_sequence<pack_nodes_t<sequence, Run>>;
+        };
+
+        template<>
+        struct flush_run<type_sequence<>>
+        {
+            using type = type_sequence<>;
+        };
+
+        template<typename Result, typename Run, typename... Nodes>
+        struct merge_runs
+        {
+            using type = concat_t<Result, typename flush_run<Run>::type>;
+        };
+
+        template<typename Result, typename Run, typename First, typename... Rest>
+        struct merge_runs<Result, Run, First, Rest ...>
+        {
+            using type = typename merge_runs<concat_t<Result, typename flush_run<Run>::type, type_sequence<First>>, type_sequence<>, Rest ...>::type;
+        };
+
+        template<typename Result, typename... Run, typename First, typename... Rest>
+        requires is_trivially_matchable<First>
+        struct merge_runs<Result, type_sequence<Run ...>, First, Rest ...>
+        {
+            using type = typename merge_runs<Result, type_sequence<Run ..., First>, Rest ...>::type;
+        };
+    }
+
+    /**
+     * Optimization pass that merges runs of adjacent trivially matchable nodes (e.g. literals)
+     * inside sequences. Each run becomes a nested sequence which is matched in a single step,
+     * with only one bounds check and without creating a continuation for every node.
+     *
+     * @note This pass must run after all passes which expect flat sequences.
+     *
+     * @tparam Node The AST node type being processed
+     */
+    template<typename Node>
+    struct merge_trivial_runs : transform<Node, merge_trivial_runs> {};
+
+    template<typename Node>
+    using merge_trivial_runs_t = typename merge_trivial_runs<Node>::type;
+
+    template<typename... Nodes>
+    struct merge_trivial_runs<sequence<Nodes ...>>
+    {
+        using type = unpack_t<sequence, typename detail::merge_runs<type_sequence<>, type_sequence<>, merge_trivial_runs_t<Nodes> ...>::type>;
+    };
+
+    template<typename... Nodes>
+    requires are_trivially_matchable<Nodes ...>
+    struct merge_trivial_runs<sequence<Nodes ...>>
+    {
+        using type = sequence<Nodes ...>;
+    };
+}
+#endif //MREGEX_PASSES_TRIVIAL_RUN_MERGING_HPP
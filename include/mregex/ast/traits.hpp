@@ -1,7 +1,9 @@
 #ifndef MREGEX_AST_TRAITS_HPP
 #define MREGEX_AST_TRAITS_HPP
 
+#include <algorithm>
 #include <concepts>
+#include <limits>
 #include <mregex/ast/astfwd.hpp>
 #include <mregex/utility/type_sequence.hpp>
 #include <mregex/utility/type_traits.hpp>
@@ -90,6 +92,176 @@ namespace meta::ast
         using type = push_t<capture_name_spec_t<Inner>, Name>;
     };
 
+    /**
+     * Metafunction that lists all capturing groups referenced by backreferences in the AST.
+     * Groups referenced by ID are listed as std::integral_constant types, while groups
+     * referenced by name are listed as symbol::name types.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    struct backref_spec
+    {
+        using type = type_sequence<>;
+    };
+
+    template<typename Node>
+    using backref_spec_t = typename backref_spec<Node>::type;
+
+    template<template<typename...> typename Wrapper, typename... Nodes>
+    struct backref_spec<Wrapper<Nodes ...>>
+    {
+        using type = concat_t<backref_spec_t<Nodes> ...>;
+    };
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    struct backref_spec<basic_repetition<Mode, A, B, Inner>>
+    {
+        using type = backref_spec_t<Inner>;
+    };
+
+    template<lookaround_direction Direction, typename Inner>
+    struct backref_spec<lookaround<Direction, Inner>>
+    {
+        using type = backref_spec_t<Inner>;
+    };
+
+    template<std::size_t ID, typename Name, typename Inner>
+    struct backref_spec<capture<ID, Name, Inner>>
+    {
+        using type = backref_spec_t<Inner>;
+    };
+
+    template<std::size_t ID>
+    struct backref_spec<backref<ID>>
+    {
+        using type = type_sequence<std::integral_constant<std::size_t, ID>>;
+    };
+
+    template<static_string Name>
+    struct backref_spec<named_backref<Name>>
+    {
+        using type = type_sequence<symbol::name<Name>>;
+    };
+
+    namespace detail
+    {
+        template<typename Node>
+        struct capture_id_spec
+        {
+            using type = type_sequence<>;
+        };
+
+        template<template<typename...> typename Wrapper, typename... Nodes>
+        struct capture_id_spec<Wrapper<Nodes ...>>
+        {
+            using type = concat_t<typename capture_id_spec<Nodes>::type ...>;
+        };
+
+        template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+        struct capture_id_spec<basic_repetition<Mode, A, B, Inner>>
+        {
+            using type = typename capture_id_spec<Inner>::type;
+        };
+
+        template<lookaround_direction Direction, typename Inner>
+        struct capture_id_spec<lookaround<Direction, Inner>>
+        {
+            using type = typename capture_id_spec<Inner>::type;
+        };
+
+        template<std::size_t ID, typename Name, typename Inner>
+        struct capture_id_spec<capture<ID, Name, Inner>>
+        {
+            using type = push_t<typename capture_id_spec<Inner>::type, std::integral_constant<std::size_t, ID>>;
+        };
+
+        /**
+         * Splits the capturing groups of the AST into groups which may be deferred
+         * and groups which must be stored eagerly.
+         */
+        template<typename Node, typename BackrefSpec>
+        struct capture_deferral
+        {
+            using deferred = type_sequence<>;
+            using eager = type_sequence<>;
+        };
+
+        template<template<typename...> typename Wrapper, typename... Nodes, typename BackrefSpec>
+        struct capture_deferral<Wrapper<Nodes ...>, BackrefSpec>
+        {
+            using deferred = concat_t<typename capture_deferral<Nodes, BackrefSpec>::deferred ...>;
+            using eager = concat_t<typename capture_deferral<Nodes, BackrefSpec>::eager ...>;
+        };
+
+        template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner, typename BackrefSpec>
+        struct capture_deferral<basic_repetition<Mode, A, B, Inner>, BackrefSpec>
+        {
+            using deferred = type_sequence<>;
+            using eager = typename capture_id_spec<Inner>::type;
+        };
+
+        template<lookaround_direction Direction, typename Inner, typename BackrefSpec>
+        struct capture_deferral<lookaround<Direction, Inner>, BackrefSpec>
+        {
+            using deferred = type_sequence<>;
+            using eager = typename capture_id_spec<Inner>::type;
+        };
+
+        template<std::size_t ID, typename Name, typename Inner, typename BackrefSpec>
+        struct capture_deferral<capture<ID, Name, Inner>, BackrefSpec>
+        {
+            using id_type = std::integral_constant<std::size_t, ID>;
+            using inner_deferral = capture_deferral<Inner, BackrefSpec>;
+
+            static constexpr bool is_referenced = contains<BackrefSpec, id_type> || contains<BackrefSpec, Name>;
+
+            using deferred = std::conditional_t
+            <
+                is_referenced,
+                typename inner_deferral::deferred,
+                push_t<typename inner_deferral::deferred, id_type>
+            >;
+            using eager = std::conditional_t
+            <
+                is_referenced,
+                push_t<typename inner_deferral::eager, id_type>,
+                typename inner_deferral::eager
+            >;
+        };
+
+        template<typename Candidates, typename Excluded>
+        struct exclude_ids;
+
+        template<typename... IDs, typename Excluded>
+        struct exclude_ids<type_sequence<IDs ...>, Excluded>
+        {
+            using type = concat_t<std::conditional_t<contains<Excluded, IDs>, type_sequence<>, type_sequence<IDs>> ...>;
+        };
+
+        template<typename Node>
+        struct deferred_capture_spec
+        {
+            using deferral = capture_deferral<Node, backref_spec_t<Node>>;
+            using type = typename exclude_ids<typename deferral::deferred, typename deferral::eager>::type;
+        };
+    }
+
+    /**
+     * Metafunction that lists the IDs of capturing groups which can be stored only after
+     * the rest of the regex has matched, as std::integral_constant types.
+     *
+     * @note This is the case for groups which are matched at most once per attempt and whose
+     * content is not needed during matching, i.e. groups which are not inside repetitions or
+     * lookarounds and are not referenced by backreferences. Repetitions and lookarounds
+     * match their inner nodes with local continuations, so success is not final there.
+     * Groups which share an ID are only deferred if none of them needs to be stored eagerly.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    using deferred_capture_spec_t = typename detail::deferred_capture_spec<Node>::type;
+
     /**
      * Base type used to tag all AST nodes which are zero-length matchers.
      * A node is a zero-length matcher if it may match inputs of length zero.
@@ -127,5 +299,176 @@ namespace meta::ast
         typename Node::predicate_type;
         { Node::predicate_type::is_match(iter, iter, iter, ctx) } -> std::same_as<bool>;
     };
+
+    /**
+     * Width of the inputs matched by AST nodes which have no upper bound on their length.
+     */
+    inline constexpr std::size_t unbounded_width = std::numeric_limits<std::size_t>::max();
+
+    namespace detail
+    {
+        constexpr std::size_t saturating_add(std::size_t lhs, std::size_t rhs) noexcept
+        {
+            return unbounded_width - lhs < rhs ? unbounded_width : lhs + rhs;
+        }
+
+        constexpr std::size_t saturating_multiply(std::size_t lhs, std::size_t rhs) noexcept
+        {
+            return lhs != 0 && unbounded_width / lhs < rhs ? unbounded_width : lhs * rhs;
+        }
+
+        template<std::size_t... Values>
+        inline constexpr std::size_t saturating_sum = []() noexcept {
+            std::size_t result = 0;
+            ((result = saturating_add(result, Values)), ...);
+            return result;
+        }();
+
+        template<symbol::quantifier Bound>
+        constexpr std::size_t repeated_width(std::size_t width) noexcept
+        {
+            if (width == 0)
+                return 0;
+            if constexpr (symbol::is_infinity<Bound>)
+                return unbounded_width;
+            else
+                return saturating_multiply(symbol::get_value<Bound>, width);
+        }
+
+        template<std::size_t... Values>
+        inline constexpr std::size_t min_of = std::min({Values ...});
+
+        template<std::size_t... Values>
+        inline constexpr std::size_t max_of = std::max({Values ...});
+    }
+
+    /**
+     * Metafunction that computes the minimum length of an input matched by the AST node.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr std::size_t min_width = 0;
+
+    /**
+     * Metafunction that computes the maximum length of an input matched by the AST node.
+     * Nodes which can match inputs of any length, like backreferences, have an unbounded width.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr std::size_t max_width = unbounded_width;
+
+    template<typename Node>
+    requires is_trivially_matchable<Node>
+    inline constexpr std::size_t min_width<Node> = 1;
+
+    template<typename Node>
+    requires is_trivially_matchable<Node>
+    inline constexpr std::size_t max_width<Node> = 1;
+
+    template<typename Node>
+    requires is_assertion<Node>
+    inline constexpr std::size_t max_width<Node> = 0;
+
+    template<>
+    inline constexpr std::size_t max_width<empty> = 0;
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<sequence<Nodes ...>>)
+    inline constexpr std::size_t min_width<sequence<Nodes ...>> = detail::saturating_sum<min_width<Nodes> ...>;
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<sequence<Nodes ...>>)
+    inline constexpr std::size_t max_width<sequence<Nodes ...>> = detail::saturating_sum<max_width<Nodes> ...>;
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<alternation<Nodes ...>>)
+    inline constexpr std::size_t min_width<alternation<Nodes ...>> = detail::min_of<min_width<Nodes> ...>;
+
+    template<typename... Nodes>
+    requires (!is_trivially_matchable<alternation<Nodes ...>>)
+    inline constexpr std::size_t max_width<alternation<Nodes ...>> = detail::max_of<max_width<Nodes> ...>;
+
+    template<std::size_t ID, typename Name, typename Inner>
+    inline constexpr std::size_t min_width<capture<ID, Name, Inner>> = min_width<Inner>;
+
+    template<std::size_t ID, typename Name, typename Inner>
+    inline constexpr std::size_t max_width<capture<ID, Name, Inner>> = max_width<Inner>;
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    inline constexpr std::size_t min_width<basic_repetition<Mode, A, B, Inner>> = detail::repeated_width<A>(min_width<Inner>);
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    inline constexpr std::size_t max_width<basic_repetition<Mode, A, B, Inner>> = detail::repeated_width<B>(max_width<Inner>);
+
+    /**
+     * Metafunction that computes how many characters before the start of a match
+     * can be inspected by the assertions inside an AST node.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr std::size_t lookbehind_reach = 0;
+
+    /**
+     * Metafunction that computes how many characters after the end of a match
+     * can be inspected by the assertions inside an AST node.
+     *
+     * @tparam Node The AST node
+     */
+    template<typename Node>
+    inline constexpr std::size_t lookahead_reach = 0;
+
+    template<template<typename...> typename Wrapper, typename... Nodes>
+    inline constexpr std::size_t lookbehind_reach<Wrapper<Nodes ...>> = detail::max_of<0, lookbehind_reach<Nodes> ...>;
+
+    template<template<typename...> typename Wrapper, typename... Nodes>
+    inline constexpr std::size_t lookahead_reach<Wrapper<Nodes ...>> = detail::max_of<0, lookahead_reach<Nodes> ...>;
+
+    template<std::size_t ID, typename Name, typename Inner>
+    inline constexpr std::size_t lookbehind_reach<capture<ID, Name, Inner>> = lookbehind_reach<Inner>;
+
+    template<std::size_t ID, typename Name, typename Inner>
+    inline constexpr std::size_t lookahead_reach<capture<ID, Name, Inner>> = lookahead_reach<Inner>;
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    inline constexpr std::size_t lookbehind_reach<basic_repetition<Mode, A, B, Inner>> = lookbehind_reach<Inner>;
+
+    template<match_mode Mode, symbol::finite_quantifier A, symbol::quantifier B, typename Inner>
+    inline constexpr std::size_t lookahead_reach<basic_repetition<Mode, A, B, Inner>> = lookahead_reach<Inner>;
+
+    template<typename Inner>
+    inline constexpr std::size_t lookbehind_reach<lookaround<lookaround_direction::behind, Inner>> =
+            detail::saturating_add(max_width<Inner>, lookbehind_reach<Inner>);
+
+    template<typename Inner>
+    inline constexpr std::size_t lookahead_reach<lookaround<lookaround_direction::behind, Inner>> = lookahead_reach<Inner>;
+
+    template<typename Inner>
+    inline constexpr std::size_t lookbehind_reach<lookaround<lookaround_direction::ahead, Inner>> = lookbehind_reach<Inner>;
+
+    template<typename Inner>
+    inline constexpr std::size_t lookahead_reach<lookaround<lookaround_direction::ahead, Inner>> =
+            detail::saturating_add(max_width<Inner>, lookahead_reach<Inner>);
+
+    // Anchors compare the position with the bounds of the input or inspect one adjacent character
+    template<>
+    inline constexpr std::size_t lookbehind_reach<beginning_of_input> = 1;
+
+    template<>
+    inline constexpr std::size_t lookbehind_reach<beginning_of_line> = 1;
+
+    template<>
+    inline constexpr std::size_t lookbehind_reach<word_boundary> = 1;
+
+    template<>
+    inline constexpr std::size_t lookahead_reach<end_of_input> = 1;
+
+    template<>
+    inline constexpr std::size_t lookahead_reach<end_of_line> = 1;
+
+    template<>
+    inline constexpr std::size_t lookahead_reach<word_boundary> = 1;
 }
 #endif //MREGEX_AST_TRAITS_HPP
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define MREGEX_AST_TRANSFORM_HPP
 
 #include <mregex/ast/astfwd.hpp>
+#include <mregex/utility/type_sequence.hpp>
 
 namespace meta::ast
 {
@@ -41,5 +42,40 @@ namespace meta::ast
     {
         using type = capture<ID, Name, typename Func<Inner>::type>;
     };
+
+    /**
+     * Metafunction that packs a sequence of AST nodes into a wrapper node.
+     * A single node is not wrapped, since the wrapper would be redundant.
+     * An empty sequence of nodes is packed into ast::empty.
+     *
+     * @tparam Wrapper  The type of the wrapper
+     * @tparam Nodes    A type sequence with the AST nodes to be packed
+     */
+    template<template<typename...> typename Wrapper, typename Nodes>
+    struct pack_nodes
+    {
+        using type = unpack_t<Wrapper, Nodes>;
+    };
+
+    template<template<typename...> typename Wrapper, typename Node>
+    struct pack_nodes<Wrapper, type_sequence<Node>>
+    {
+        using type = Node;
+    };
+
+    template<template<typename...> typename Wrapper>
+    struct pack_nodes<Wrapper, type_sequence<>>
+    {
+        using type = empty;
+    };
+
+    template<>
+    struct pack_nodes<set, type_sequence<>>
+    {
+        using type = nothing;
+    };
+
+    template<template<typename...> typename Wrapper, typename Nodes>
+    using pack_nodes_t = typename pack_nodes<Wrapper, Nodes>::type;
 }
 #endif //MREGEX_AST_TRANSFORM_HPP
\ No newline at end of file
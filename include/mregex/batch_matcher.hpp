@@ -0,0 +1,76 @@
+#ifndef MREGEX_BATCH_MATCHER_HPP
+#define MREGEX_BATCH_MATCHER_HPP
+
+#include <cassert>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <mregex/ast/traits.hpp>
+#include <mregex/regex_match_context.hpp>
+
+namespace meta
+{
+    /**
+     * Matches many short inputs exactly and writes one result for each of them.
+     * A single match context is reused for all inputs, and inputs which are shorter
+     * or longer than any match of the regex are rejected without matching.
+     *
+     * @tparam Method   The regex method used for exact matching
+     * @tparam Result   The result type, either bool or a match result view
+     */
+    template<typename Method, typename Result>
+    struct batch_matcher
+    {
+        using method = Method;
+        using regex_type = typename method::regex_type;
+        using ast_type = regex_ast_t<regex_type>;
+        using iterator = std::string_view::const_iterator;
+        using context_type = regex_match_context<regex_type, iterator>;
+        using result_type = Result;
+
+        static constexpr std::size_t min_length = ast::min_width<ast_type>;
+        static constexpr std::size_t max_length = ast::max_width<ast_type>;
+
+        /**
+         * Matches all inputs on the current thread.
+         *
+         * @param inputs    The inputs to be matched
+         * @param results   The results, which must have at least as many elements as the inputs (checked with an assertion)
+         */
+        static constexpr void match(std::span<std::string_view const> inputs, std::span<result_type> results) noexcept
+        {
+            context_type ctx{};
+            match(inputs, results, ctx);
+        }
+
+        /**
+         * Matches all inputs with a context supplied by the caller, which can reuse it across batches.
+         *
+         * @param inputs    The inputs to be matched
+         * @param results   The results, which must have at least as many elements as the inputs (checked with an assertion)
+         * @param ctx       The match context used for all inputs
+         */
+        static constexpr void match(std::span<std::string_view const> inputs, std::span<result_type> results, context_type &ctx) noexcept
+        {
+            assert(results.size() >= inputs.size());
+
+            for (std::size_t i = 0; i != inputs.size(); ++i)
+            {
+                std::string_view const input = inputs[i];
+                if (input.size() < min_length || input.size() > max_length)
+                {
+                    results[i] = result_type{};
+                    continue;
+                }
+
+                ctx.reset();
+                bool const matched = method::invoke(input.begin(), input.end(), input.begin(), ctx).matched;
+                if constexpr (std::is_same_v<result_type, bool>)
+                    results[i] = matched;
+                else
+                    results[i] = result_type{ctx.captures, matched};
+            }
+        }
+    };
+}
+#endif //MREGEX_BATCH_MATCHER_HPP
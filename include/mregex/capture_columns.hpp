@@ -0,0 +1,240 @@
+#ifndef MREGEX_CAPTURE_COLUMNS_HPP
+#define MREGEX_CAPTURE_COLUMNS_HPP
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+#include <mregex/regex_traits.hpp>
+
+namespace meta
+{
+    /**
+     * Offsets of the content captured by a regex group, relative to the beginning of the input.
+     * Groups which did not participate in the match have both offsets set to the unset value.
+     */
+    struct capture_offsets
+    {
+        static constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+
+        std::size_t begin{unset};
+        std::size_t end{unset};
+
+        constexpr bool is_set() const noexcept
+        {
+            return begin != unset;
+        }
+
+        constexpr auto length() const noexcept -> std::size_t
+        {
+            return end - begin;
+        }
+
+        constexpr bool operator==(capture_offsets const &) const noexcept = default;
+    };
+
+    /**
+     * Row of capture offsets written for each match, one element per capturing group.
+     */
+    template<std::size_t GroupCount>
+    using capture_offsets_row = std::array<capture_offsets, GroupCount>;
+
+    /**
+     * Concept used to constrain a type that consumes the capture offsets of each match.
+     * The sink returns false if it cannot accept the row, which stops the extraction.
+     */
+    template<typename Sink, std::size_t GroupCount>
+    concept capture_offsets_sink = requires (Sink &sink, capture_offsets_row<GroupCount> const &row)
+    {
+        { sink.push(row) } -> std::convertible_to<bool>;
+    };
+
+    /**
+     * Summary of a bulk extraction.
+     */
+    struct extraction_status
+    {
+        std::size_t count{};
+        bool overflow{};
+    };
+
+    namespace detail
+    {
+        template<typename Name, typename NameSpec>
+        struct capture_name_index;
+
+        template<typename Name, typename... Names>
+        struct capture_name_index<Name, type_sequence<Names ...>>
+        {
+            static constexpr std::size_t value = []() {
+                std::size_t index = 0;
+                ((std::is_same_v<Name, Names> ? false : (++index, true)) && ...);
+                return index;
+            }();
+
+            static_assert(value < sizeof...(Names), "capturing group does not exist");
+        };
+
+        template<typename Regex, static_string Name>
+        inline constexpr std::size_t capture_name_index_v = capture_name_index<symbol::name<Name>, regex_capture_name_spec_t<Regex>>::value;
+
+        template<typename Regex>
+        inline constexpr std::size_t group_count_of = Regex::capture_count + 1;
+
+        template<std::random_access_iterator Iter, typename Capture>
+        constexpr auto make_capture_offsets(Iter base, Capture const &capture) noexcept -> capture_offsets
+        {
+            if (!capture.matched())
+                return {};
+            return {
+                static_cast<std::size_t>(std::distance(base, capture.begin())),
+                static_cast<std::size_t>(std::distance(base, capture.end()))
+            };
+        }
+
+        template<std::size_t GroupCount, std::random_access_iterator Iter, typename Result>
+        constexpr auto make_capture_offsets_row(Iter base, Result const &result) noexcept
+        {
+            return [&]<std::size_t... IDs>(std::index_sequence<IDs ...>) {
+                return capture_offsets_row<GroupCount>{make_capture_offsets(base, result.template group<IDs>()) ...};
+            }(std::make_index_sequence<GroupCount>{});
+        }
+    }
+
+    /**
+     * Growable structure-of-arrays that stores the capture offsets of all matches.
+     * Each capturing group has its own contiguous column.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @tparam Allocator    The allocator used by the columns (optional)
+     */
+    template<typename Regex, typename Allocator = std::allocator<capture_offsets>>
+    struct capture_columns
+    {
+        static constexpr std::size_t group_count = detail::group_count_of<Regex>;
+
+        capture_columns() = default;
+
+        explicit capture_columns(Allocator const &alloc)
+            : _columns{make_columns(alloc, std::make_index_sequence<group_count>{})}
+        {}
+
+        bool push(capture_offsets_row<group_count> const &row)
+        {
+            for (std::size_t id = 0; id != group_count; ++id)
+                _columns[id].push_back(row[id]);
+            return true;
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            for (auto &column : _columns)
+                column.reserve(capacity);
+        }
+
+        void clear() noexcept
+        {
+            for (auto &column : _columns)
+                column.clear();
+        }
+
+        auto size() const noexcept -> std::size_t
+        {
+            return _columns[0].size();
+        }
+
+        template<std::size_t ID>
+        auto column() const noexcept -> std::span<capture_offsets const>
+        {
+            static_assert(ID < group_count, "capturing group does not exist");
+            return _columns[ID];
+        }
+
+        template<static_string Name>
+        auto column() const noexcept -> std::span<capture_offsets const>
+        {
+            return column<detail::capture_name_index_v<Regex, Name>>();
+        }
+
+    private:
+        template<std::size_t... IDs>
+        static auto make_columns(Allocator const &alloc, std::index_sequence<IDs ...>)
+        {
+            return std::array<std::vector<capture_offsets, Allocator>, group_count>{std::vector<capture_offsets, Allocator>(((void) IDs, alloc)) ...};
+        }
+
+        std::array<std::vector<capture_offsets, Allocator>, group_count> _columns;
+    };
+
+    /**
+     * Structure-of-arrays that stores capture offsets in caller-provided memory.
+     * The storage is split into one column per capturing group, each with the same capacity.
+     * Rows that do not fit are rejected and the overflow is reported.
+     *
+     * @tparam Regex    The regex type used for matching
+     */
+    template<typename Regex>
+    struct capture_span_columns
+    {
+        static constexpr std::size_t group_count = detail::group_count_of<Regex>;
+
+        constexpr explicit capture_span_columns(std::span<capture_offsets> storage) noexcept
+            : _storage{storage}, _capacity{storage.size() / group_count}
+        {}
+
+        constexpr bool push(capture_offsets_row<group_count> const &row) noexcept
+        {
+            if (_size == _capacity)
+            {
+                _overflow = true;
+                return false;
+            }
+            for (std::size_t id = 0; id != group_count; ++id)
+                _storage[id * _capacity + _size] = row[id];
+            ++_size;
+            return true;
+        }
+
+        constexpr void clear() noexcept
+        {
+            _size = 0;
+            _overflow = false;
+        }
+
+        constexpr auto size() const noexcept -> std::size_t
+        {
+            return _size;
+        }
+
+        constexpr auto capacity() const noexcept -> std::size_t
+        {
+            return _capacity;
+        }
+
+        constexpr bool overflowed() const noexcept
+        {
+            return _overflow;
+        }
+
+        template<std::size_t ID>
+        constexpr auto column() const noexcept -> std::span<capture_offsets const>
+        {
+            static_assert(ID < group_count, "capturing group does not exist");
+            return _storage.subspan(ID * _capacity, _size);
+        }
+
+        template<static_string Name>
+        constexpr auto column() const noexcept -> std::span<capture_offsets const>
+        {
+            return column<detail::capture_name_index_v<Regex, Name>>();
+        }
+
+    private:
+        std::span<capture_offsets> _storage;
+        std::size_t _capacity;
+        std::size_t _size{};
+        bool _overflow{};
+    };
+}
+#endif //MREGEX_CAPTURE_COLUMNS_HPP
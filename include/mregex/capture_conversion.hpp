@@ -0,0 +1,253 @@
+#ifndef MREGEX_CAPTURE_CONVERSION_HPP
+#define MREGEX_CAPTURE_CONVERSION_HPP
+
+#include <charconv>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <mregex/match_result.hpp>
+
+namespace meta
+{
+    /**
+     * Customization point used to convert the content captured by a regex group to a value of type T.
+     * Specializations provide a static convert(capture, value) method which returns false if
+     * the captured content cannot be represented as a T.
+     *
+     * @tparam T    The type of the converted value
+     */
+    template<typename T>
+    struct capture_conversion;
+
+    /**
+     * Concept used to constrain a type that can be converted from regex captures.
+     */
+    template<typename T>
+    concept capture_convertible = requires (regex_capture_view<std::string_view::iterator> const &capture, T &value)
+    {
+        { capture_conversion<T>::convert(capture, value) } -> std::same_as<bool>;
+    };
+
+    /**
+     * Converts captured digits directly from the input, without building an intermediate string.
+     * The digits are read once more after the regex matched them, and are checked again
+     * because the regex does not have to restrict the group to digits.
+     */
+    template<std::integral T>
+    requires (!std::is_same_v<T, bool>)
+    struct capture_conversion<T>
+    {
+        template<captured_content Capture>
+        static constexpr bool convert(Capture const &capture, T &value) noexcept
+        {
+            auto current = capture.begin();
+            auto const end = capture.end();
+            bool negative = false;
+
+            if (current != end && (*current == '-' || *current == '+'))
+            {
+                if constexpr (std::is_unsigned_v<T>)
+                {
+                    if (*current == '-')
+                        return false;
+                }
+                negative = *current == '-';
+                ++current;
+            }
+            if (current == end)
+                return false;
+
+            // Accumulate towards the sign of the result, so that the minimum value does not overflow
+            T result = 0;
+            for (; current != end; ++current)
+            {
+                char const c = *current;
+                if (c < '0' || c > '9')
+                    return false;
+
+                auto const digit = static_cast<T>(c - '0');
+                if (negative)
+                {
+                    if (result < (std::numeric_limits<T>::min() + digit) / 10)
+                        return false;
+                    result = static_cast<T>(result * 10 - digit);
+                }
+                else
+                {
+                    if (result > (std::numeric_limits<T>::max() - digit) / 10)
+                        return false;
+                    result = static_cast<T>(result * 10 + digit);
+                }
+            }
+            value = result;
+            return true;
+        }
+    };
+
+    /**
+     * Converts captured content to floating point values using std::from_chars.
+     * This conversion cannot be evaluated at compile-time.
+     */
+    template<std::floating_point T>
+    struct capture_conversion<T>
+    {
+        template<captured_content Capture>
+        static bool convert(Capture const &capture, T &value)
+        {
+            auto const content = capture.content();
+            std::string_view const chars{content};
+            auto const [last, error] = std::from_chars(chars.data(), chars.data() + chars.size(), value);
+            return error == std::errc{} && last == chars.data() + chars.size();
+        }
+    };
+
+    /**
+     * Converts captured content to an enumeration from the integral value of an enumerator.
+     * Enumerator names cannot be converted without reflection, so enumerations which are
+     * spelled by name in the input require a user-defined specialization.
+     */
+    template<typename T>
+    requires std::is_enum_v<T>
+    struct capture_conversion<T>
+    {
+        template<captured_content Capture>
+        static constexpr bool convert(Capture const &capture, T &value) noexcept
+        {
+            std::underlying_type_t<T> underlying{};
+            if (!capture_conversion<std::underlying_type_t<T>>::convert(capture, underlying))
+                return false;
+            value = static_cast<T>(underlying);
+            return true;
+        }
+    };
+
+    template<>
+    struct capture_conversion<bool>
+    {
+        template<captured_content Capture>
+        static constexpr bool convert(Capture const &capture, bool &value) noexcept
+        {
+            auto const content = capture.content();
+            std::string_view const chars{content};
+            value = chars == "true" || chars == "1";
+            return value || chars == "false" || chars == "0";
+        }
+    };
+
+    template<>
+    struct capture_conversion<std::string_view>
+    {
+        template<captured_content Capture>
+        static constexpr bool convert(Capture const &capture, std::string_view &value) noexcept
+        requires std::is_convertible_v<Capture, std::string_view>
+        {
+            value = capture;
+            return true;
+        }
+    };
+
+    template<>
+    struct capture_conversion<std::string>
+    {
+        template<captured_content Capture>
+        static constexpr bool convert(Capture const &capture, std::string &value)
+        {
+            value.assign(capture.begin(), capture.end());
+            return true;
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * Placeholder convertible to any type, used to count the members of an aggregate.
+         */
+        struct any_member
+        {
+            template<typename T>
+            operator T() const noexcept;
+        };
+
+        template<typename Struct, std::size_t... Indices>
+        constexpr bool is_initializable_with(std::index_sequence<Indices ...>) noexcept
+        {
+            return requires { Struct{(static_cast<void>(Indices), any_member{}) ...}; };
+        }
+
+        /**
+         * Counts the members of an aggregate as the largest number of initializers it accepts.
+         * Members which are aggregates themselves are counted once, as long as they are
+         * not initialized through brace elision.
+         */
+        template<typename Struct, std::size_t Count = 0>
+        constexpr auto aggregate_member_count() noexcept -> std::size_t
+        {
+            if constexpr (is_initializable_with<Struct>(std::make_index_sequence<Count + 1>{}))
+                return aggregate_member_count<Struct, Count + 1>();
+            else
+                return Count;
+        }
+
+        /**
+         * Placeholder used to initialize one aggregate member from a capturing group.
+         * The member type is deduced by the conversion operator.
+         */
+        template<typename Capture>
+        struct capture_initializer
+        {
+            Capture const &capture;
+            bool &converted;
+
+            template<capture_convertible T>
+            constexpr operator T() const
+            {
+                T value{};
+                if (!capture_conversion<T>::convert(capture, value))
+                    converted = false;
+                return value;
+            }
+        };
+
+        template<typename Struct, typename Result, std::size_t... IDs>
+        constexpr auto convert_captures(Result const &result, std::index_sequence<IDs ...>) -> std::optional<Struct>
+        {
+            bool converted = true;
+            Struct value{capture_initializer<std::remove_cvref_t<decltype(result.template group<IDs + 1>())>>{
+                result.template group<IDs + 1>(), converted
+            } ...};
+            if (!converted)
+                return std::nullopt;
+            return value;
+        }
+    }
+
+    /**
+     * Converts the capturing groups of a match result into the members of an aggregate.
+     * Group number i + 1 initializes the i-th member, while the implicit group is ignored.
+     * The aggregate must have exactly one member for each capturing group.
+     *
+     * @note Members are deduced through a templated conversion operator, so they cannot
+     * be std::optional, whose converting constructor would bypass the deduction.
+     *
+     * @tparam Struct   The aggregate type that receives the converted groups
+     * @param result    The match result that holds the captures
+     * @return          The aggregate if the regex matched and all conversions succeeded
+     */
+    template<typename Struct, typename Result>
+    constexpr auto convert_captures(Result const &result) -> std::optional<Struct>
+    {
+        static_assert(std::is_aggregate_v<Struct>, "captures can only be converted to aggregate types");
+        static_assert(
+                detail::aggregate_member_count<Struct>() == Result::group_count - 1,
+                "the aggregate must have one member for each capturing group"
+        );
+
+        if (!result.matched())
+            return std::nullopt;
+        return detail::convert_captures<Struct>(result, std::make_index_sequence<Result::group_count - 1>{});
+    }
+}
+#endif //MREGEX_CAPTURE_CONVERSION_HPP
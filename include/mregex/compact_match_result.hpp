@@ -0,0 +1,250 @@
+#ifndef MREGEX_COMPACT_MATCH_RESULT_HPP
+#define MREGEX_COMPACT_MATCH_RESULT_HPP
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <mregex/regex_capture_storage.hpp>
+
+namespace meta
+{
+    template<capture_storage CaptureStorage>
+    struct basic_match_result;
+
+    namespace detail
+    {
+        template<typename T>
+        inline constexpr bool is_random_access_capture_view_storage = false;
+
+        template<std::random_access_iterator Iter, typename... Names>
+        inline constexpr bool is_random_access_capture_view_storage<std::tuple<regex_capture_view<Iter, Names> ...>> = true;
+
+        template<typename CaptureStorage>
+        struct capture_view_storage_iterator;
+
+        template<std::forward_iterator Iter, typename... Names>
+        struct capture_view_storage_iterator<std::tuple<regex_capture_view<Iter, Names> ...>>
+        {
+            using type = Iter;
+        };
+    }
+
+    /**
+     * Result of matching a regex which stores the captured ranges as offsets
+     * relative to a single base iterator.
+     * Capturing groups are rebuilt as views when they are accessed.
+     *
+     * @note The offsets of all captured ranges must be smaller than the largest value of the Offset type,
+     * which is checked with an assertion when the result is constructed.
+     * The input's lifetime must not expire before this object.
+     *
+     * @tparam CaptureStorage   The view storage type rebuilt on access
+     * @tparam Offset           The unsigned integral type used to store offsets
+     */
+    template<capture_storage CaptureStorage, std::unsigned_integral Offset = std::uint32_t>
+    struct basic_compact_match_result
+    {
+        static_assert(
+            detail::is_random_access_capture_view_storage<CaptureStorage>,
+            "compact match results require views over random access iterators"
+        );
+
+        using capture_storage_type = CaptureStorage;
+        using implicit_capture_type = std::tuple_element_t<0, capture_storage_type>;
+        using iterator = typename detail::capture_view_storage_iterator<capture_storage_type>::type;
+        using offset_type = Offset;
+
+        static constexpr bool is_view = true;
+        static constexpr std::size_t group_count = std::tuple_size_v<capture_storage_type>;
+
+        // Offset of groups which never participated in the match
+        static constexpr offset_type unset_offset = std::numeric_limits<offset_type>::max();
+
+        constexpr basic_compact_match_result() noexcept = default;
+
+        constexpr basic_compact_match_result(iterator base, basic_match_result<capture_storage_type> const &result) noexcept
+            : _base{base}, _matched{result.matched()}
+        {
+            init_offsets(result, std::make_index_sequence<group_count>{});
+        }
+
+        constexpr bool matched() const noexcept
+        {
+            return _matched;
+        }
+
+        constexpr auto length() const noexcept -> std::size_t
+        {
+            return _offsets[1] - _offsets[0];
+        }
+
+        constexpr auto begin() const noexcept
+        {
+            return group<0>().begin();
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return group<0>().end();
+        }
+
+        /**
+         * Rebuilds a match result which holds iterator-based views into the matched content.
+         *
+         * @return  A new match result object that holds views into the input
+         */
+        [[nodiscard]] constexpr auto as_view() const noexcept
+        {
+            return basic_match_result<capture_storage_type>{
+                build_captures(std::make_index_sequence<group_count>{}),
+                _matched
+            };
+        }
+
+        /**
+         * Performs a deep copy of all regex captures and returns
+         * a new match result container that owns the memory.
+         *
+         * @return  A new match result object that holds ownership of captures
+         */
+        [[nodiscard]] auto as_memory_owner() const
+        {
+            return as_view().as_memory_owner();
+        }
+
+        template<typename Allocator>
+        [[nodiscard]] auto as_memory_owner(Allocator const &alloc) const
+        {
+            return as_view().as_memory_owner(alloc);
+        }
+
+        /**
+         * Returns a view into the capturing group with the specified number.
+         *
+         * @tparam ID   The number of the requested capturing group
+         * @return      The capturing group
+         */
+        template<std::size_t ID>
+        constexpr auto group() const noexcept
+        {
+            static_assert(ID < group_count, "capturing group does not exist");
+            using capture_type = std::tuple_element_t<ID, capture_storage_type>;
+
+            offset_type const begin_offset = _offsets[2 * ID];
+            if (begin_offset == unset_offset)
+                return capture_type{};
+            return capture_type{std::next(_base, begin_offset), std::next(_base, _offsets[2 * ID + 1])};
+        }
+
+        /**
+         * Returns a view into the capturing group with the specified name.
+         *
+         * @tparam Name The name of the requested capturing group
+         * @return      The capturing group
+         */
+        template<static_string Name>
+        constexpr auto group() const noexcept
+        {
+            return group<name_index<Name>(std::make_index_sequence<group_count>{})>();
+        }
+
+        /**
+         * Tuple-like interface for structured binding decomposition.
+         */
+        template<std::size_t ID>
+        constexpr auto get() const noexcept
+        {
+            return group<ID>();
+        }
+
+        constexpr bool operator==(bool value) const noexcept
+        {
+            return _matched == value;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return _matched;
+        }
+
+        constexpr explicit(false) operator std::string_view() const noexcept
+        requires std::is_convertible_v<implicit_capture_type, std::string_view>
+        {
+            return static_cast<std::string_view>(group<0>());
+        }
+
+    private:
+        template<std::size_t... IDs>
+        constexpr void init_offsets(basic_match_result<capture_storage_type> const &result, std::index_sequence<IDs ...>) noexcept
+        {
+            ((store_offsets<IDs>(result.template group<IDs>())), ...);
+        }
+
+        template<std::size_t ID, typename Capture>
+        constexpr void store_offsets(Capture const &capture) noexcept
+        {
+            if (!capture.matched())
+                return;
+
+            auto const begin_offset = std::distance(_base, capture.begin());
+            auto const end_offset = std::distance(_base, capture.end());
+            // The largest offset is reserved for unset groups
+            assert(begin_offset >= 0 && static_cast<std::make_unsigned_t<decltype(end_offset)>>(end_offset) < unset_offset);
+            _offsets[2 * ID] = static_cast<offset_type>(begin_offset);
+            _offsets[2 * ID + 1] = static_cast<offset_type>(end_offset);
+        }
+
+        template<std::size_t... IDs>
+        constexpr auto build_captures(std::index_sequence<IDs ...>) const noexcept
+        {
+            return capture_storage_type{group<IDs>() ...};
+        }
+
+        template<static_string Name, std::size_t... IDs>
+        static constexpr auto name_index(std::index_sequence<IDs ...>) noexcept -> std::size_t
+        {
+            using capture_type = named_capture_type_for<capture_storage_type, Name>;
+
+            std::size_t index = group_count;
+            ((index = std::is_same_v<std::tuple_element_t<IDs, capture_storage_type>, capture_type> ? IDs : index), ...);
+            return index;
+        }
+
+        iterator _base{};
+        std::array<offset_type, 2 * group_count> _offsets{make_unset_offsets()};
+        bool _matched{};
+
+        static constexpr auto make_unset_offsets() noexcept
+        {
+            std::array<offset_type, 2 * group_count> offsets{};
+            offsets.fill(unset_offset);
+            return offsets;
+        }
+    };
+
+    /**
+     * Result that stores offsets into the matched content.
+     * The original input's lifetime must not expire before this object.
+     *
+     * @tparam Regex    The regex type used for matching
+     * @tparam Iter     The random access iterator type used to view the matched content
+     * @tparam Offset   The unsigned integral type used to store offsets
+     */
+    template<typename Regex, std::random_access_iterator Iter, std::unsigned_integral Offset = std::uint32_t>
+    using compact_match_result = basic_compact_match_result<regex_capture_view_storage<Regex, Iter>, Offset>;
+}
+
+template<meta::capture_storage CaptureStorage, std::unsigned_integral Offset>
+struct std::tuple_size<meta::basic_compact_match_result<CaptureStorage, Offset>>
+{
+    static constexpr std::size_t value = meta::basic_compact_match_result<CaptureStorage, Offset>::group_count;
+};
+
+template<size_t ID, meta::capture_storage CaptureStorage, std::unsigned_integral Offset>
+struct std::tuple_element<ID, meta::basic_compact_match_result<CaptureStorage, Offset>>
+{
+    using type = std::tuple_element_t<ID, CaptureStorage>;
+};
+#endif //MREGEX_COMPACT_MATCH_RESULT_HPP
@@ -0,0 +1,207 @@
+#ifndef MREGEX_LINE_RANGE_HPP
+#define MREGEX_LINE_RANGE_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <mregex/ast/first_set.hpp>
+#include <mregex/utility/char_set.hpp>
+#include <mregex/regex_capture.hpp>
+#include <mregex/regex_match_context.hpp>
+
+namespace meta
+{
+    namespace detail
+    {
+        /**
+         * Finds the first occurrence of a character in a range.
+         * Contiguous ranges are scanned with memchr outside of constant evaluation.
+         */
+        template<std::forward_iterator Iter>
+        constexpr auto find_char(Iter current, Iter end, char c) noexcept -> Iter
+        {
+            if constexpr (std::contiguous_iterator<Iter> && std::is_same_v<std::iter_value_t<Iter>, char>)
+            {
+                if (!std::is_constant_evaluated() && current != end)
+                {
+                    auto const first = std::to_address(current);
+                    auto const found = static_cast<char const *>(std::memchr(first, c, static_cast<std::size_t>(end - current)));
+                    return found ? current + (found - first) : end;
+                }
+            }
+            return std::find(current, end, c);
+        }
+    }
+
+    /**
+     * A lazy view of the lines of a forward range which contain a match of a regex,
+     * or which do not contain any match if the range is inverted.
+     * Lines are terminated by line feeds, which are not part of the yielded lines.
+     * As with grep, a final line feed does not start another line, and an empty input has no lines.
+     *
+     * Candidate positions are located with the start set of the regex over the whole input,
+     * so lines without candidates are skipped after a single scan for the line feed.
+     * The regex is only verified inside the line of a candidate, and the search resumes
+     * from the next line after a hit.
+     *
+     * @tparam Method   The regex method used to search inside a line
+     * @tparam Iter     The forward iterator type used to access the input
+     * @tparam Inverted Whether the range yields the lines that do not contain a match
+     */
+    template<typename Method, std::forward_iterator Iter, bool Inverted = false>
+    struct line_range : std::ranges::view_interface<line_range<Method, Iter, Inverted>>
+    {
+        using method = Method;
+        using regex_type = typename method::regex_type;
+        using context_type = regex_match_context<regex_type, Iter>;
+        using value_type = regex_capture_view<Iter>;
+
+        constexpr line_range() noexcept = default;
+
+        constexpr line_range(Iter begin, Iter end) noexcept
+            : _current{begin}, _end{end}, _last_line{begin == end}
+        {
+            next();
+        }
+
+        /**
+         * Advances the range to the next line.
+         *
+         * @return  True if a new line was found, false otherwise
+         */
+        constexpr bool next() noexcept
+        {
+            while (!_last_line)
+            {
+                if (!_has_candidate)
+                {
+                    _candidate = find_candidate(_current);
+                    _has_candidate = true;
+                }
+
+                Iter const line_begin = _current;
+                Iter line_end = detail::find_char(line_begin, _candidate, '\n');
+                bool matched = false;
+                if (line_end == _candidate)
+                {
+                    line_end = detail::find_char(_candidate, _end, '\n');
+                    _ctx.reset();
+                    matched = method::invoke(line_begin, line_end, _candidate, _ctx).matched;
+                    _has_candidate = false;
+                }
+
+                // A line feed terminates its line, so it is not followed by an empty line at the end
+                if (line_end != _end)
+                    _current = std::next(line_end);
+                _last_line = line_end == _end || _current == _end;
+
+                if (matched != Inverted)
+                {
+                    _line = value_type{line_begin, line_end};
+                    return _active = true;
+                }
+            }
+            return _active = false;
+        }
+
+        constexpr auto const &line() const noexcept
+        {
+            return _line;
+        }
+
+        /**
+         * Consumes the remaining lines and counts them.
+         *
+         * @return  The number of lines which were not visited yet, including the current one
+         */
+        constexpr auto count() noexcept -> std::size_t
+        {
+            std::size_t line_count = 0;
+            for (; _active; next())
+                ++line_count;
+            return line_count;
+        }
+
+        struct iterator
+        {
+            using value_type = typename line_range<Method, Iter, Inverted>::value_type;
+            using pointer = value_type const *;
+            using reference = value_type const &;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr explicit iterator(line_range &range) noexcept
+                : _target{&range}
+            {}
+
+            constexpr reference operator*() const noexcept
+            {
+                return _target->line();
+            }
+
+            constexpr pointer operator->() const noexcept
+            {
+                return &_target->line();
+            }
+
+            constexpr iterator &operator++() noexcept
+            {
+                _target->next();
+                return *this;
+            }
+
+            constexpr void operator++(int) noexcept
+            {
+                _target->next();
+            }
+
+            constexpr bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return !_target->_active;
+            }
+
+        private:
+            line_range *_target{nullptr};
+        };
+
+        /**
+         * Returns an input iterator to the current line.
+         *
+         * @return  An input iterator pointing to the current line
+         */
+        constexpr auto begin() noexcept
+        {
+            return iterator{*this};
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        constexpr auto find_candidate(Iter current) const noexcept -> Iter
+        {
+            constexpr char_set start_chars = ast::start_set<typename method::ast_type, typename context_type::flags>;
+
+            if constexpr (start_chars != char_set::full())
+                return find_in_set(current, _end, start_chars);
+            else
+                return current;
+        }
+
+        Iter _current{};
+        Iter _end{};
+        Iter _candidate{};
+        value_type _line{};
+        context_type _ctx{};
+        bool _has_candidate{};
+        bool _active{};
+        bool _last_line{};
+    };
+}
+#endif //MREGEX_LINE_RANGE_HPP
@@ -0,0 +1,388 @@
+#ifndef MREGEX_MAPPED_FILE_HPP
+#define MREGEX_MAPPED_FILE_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+#include <mregex/stream_searcher.hpp>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace meta
+{
+    /**
+     * A read-only memory mapping of a file which can be searched as a contiguous range of characters.
+     * The whole file is mapped on construction, and smaller windows of it can be mapped later,
+     * which allows processing files that do not fit in the address space.
+     * The kernel is advised that the mapping will be read sequentially.
+     *
+     * Errors are not reported with exceptions: a file which cannot be opened or mapped
+     * results in an object which is not open and has an empty view.
+     *
+     * @note The mapping is not copied, so views and match results obtained from it are
+     * invalidated when the object is destroyed or when another window is mapped.
+     */
+    struct mapped_file
+    {
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // Window used to search files which are too large to be mapped at once
+        static constexpr std::size_t default_window = sizeof(void *) >= 8 ? std::size_t{1} << 30 : std::size_t{1} << 26;
+
+        mapped_file() noexcept = default;
+
+        /**
+         * Opens a file and maps its first characters into memory.
+         *
+         * @param path      The path of the file
+         * @param length    The maximum number of characters mapped, by default the whole file
+         */
+        explicit mapped_file(std::filesystem::path const &path, std::size_t length = npos) noexcept
+        {
+            if (open(path))
+                map(0, length);
+        }
+
+        mapped_file(mapped_file const &) = delete;
+        mapped_file &operator=(mapped_file const &) = delete;
+
+        mapped_file(mapped_file &&other) noexcept
+        {
+            swap(other);
+        }
+
+        mapped_file &operator=(mapped_file &&other) noexcept
+        {
+            mapped_file{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        ~mapped_file()
+        {
+            unmap();
+            close();
+        }
+
+        /**
+         * Checks if the file was opened and the last requested window was mapped.
+         */
+        auto is_open() const noexcept -> bool
+        {
+            return _is_open;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _is_open;
+        }
+
+        /**
+         * Returns the size of the entire file.
+         */
+        auto file_size() const noexcept -> std::uint64_t
+        {
+            return _file_size;
+        }
+
+        /**
+         * Returns the position of the mapped window in the file.
+         */
+        auto offset() const noexcept -> std::uint64_t
+        {
+            return _offset;
+        }
+
+        auto data() const noexcept -> char const *
+        {
+            return _view.data();
+        }
+
+        auto size() const noexcept -> std::size_t
+        {
+            return _view.size();
+        }
+
+        auto begin() const noexcept -> char const *
+        {
+            return _view.data();
+        }
+
+        auto end() const noexcept -> char const *
+        {
+            return _view.data() + _view.size();
+        }
+
+        auto view() const noexcept -> std::string_view
+        {
+            return _view;
+        }
+
+        operator std::string_view() const noexcept
+        {
+            return _view;
+        }
+
+        /**
+         * Replaces the mapped window with another part of the file.
+         * The offset does not have to be aligned, the mapping is adjusted internally.
+         *
+         * @param offset    The position in the file where the window starts
+         * @param length    The maximum number of characters mapped
+         * @return          True if the window was mapped, false otherwise
+         */
+        auto map(std::uint64_t offset, std::size_t length = npos) noexcept -> bool
+        {
+            unmap();
+            if (!_handle_valid || offset > _file_size)
+                return _is_open = false;
+
+            _offset = offset;
+            length = static_cast<std::size_t>((std::min)(static_cast<std::uint64_t>(length), _file_size - offset));
+            if (length == 0)
+                return _is_open = true;
+
+            std::uint64_t const aligned_offset = offset - offset % allocation_granularity();
+            auto const padding = static_cast<std::size_t>(offset - aligned_offset);
+            if (length > npos - padding)
+                return _is_open = false;
+
+            void *mapping = map_region(aligned_offset, padding + length);
+            if (!mapping)
+                return _is_open = false;
+
+            _mapping = mapping;
+            _mapping_length = padding + length;
+            _view = std::string_view{static_cast<char const *>(mapping) + padding, length};
+            return _is_open = true;
+        }
+
+        void swap(mapped_file &other) noexcept
+        {
+            std::swap(_handle, other._handle);
+            std::swap(_handle_valid, other._handle_valid);
+            std::swap(_is_open, other._is_open);
+            std::swap(_file_size, other._file_size);
+            std::swap(_offset, other._offset);
+            std::swap(_mapping, other._mapping);
+            std::swap(_mapping_length, other._mapping_length);
+            std::swap(_view, other._view);
+        }
+
+    private:
+#if defined(_WIN32)
+        using native_handle = HANDLE;
+
+        bool open(std::filesystem::path const &path) noexcept
+        {
+            _handle = ::CreateFileW(
+                    path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+            );
+            if (_handle == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(_handle, &size))
+            {
+                ::CloseHandle(_handle);
+                return false;
+            }
+            _file_size = static_cast<std::uint64_t>(size.QuadPart);
+            return _handle_valid = true;
+        }
+
+        void close() noexcept
+        {
+            if (_handle_valid)
+                ::CloseHandle(_handle);
+            _handle_valid = false;
+        }
+
+        static auto allocation_granularity() noexcept -> std::uint64_t
+        {
+            SYSTEM_INFO info;
+            ::GetSystemInfo(&info);
+            return info.dwAllocationGranularity;
+        }
+
+        auto map_region(std::uint64_t offset, std::size_t length) const noexcept -> void *
+        {
+            HANDLE mapping_handle = ::CreateFileMappingW(_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_handle)
+                return nullptr;
+
+            void *mapping = ::MapViewOfFile(
+                    mapping_handle, FILE_MAP_READ,
+                    static_cast<DWORD>(offset >> 32), static_cast<DWORD>(offset & 0xFFFFFFFF), length
+            );
+            // The view keeps the file mapping object alive
+            ::CloseHandle(mapping_handle);
+            return mapping;
+        }
+
+        void unmap() noexcept
+        {
+            if (_mapping)
+                ::UnmapViewOfFile(_mapping);
+            reset_view();
+        }
+#else
+        using native_handle = int;
+
+        bool open(std::filesystem::path const &path) noexcept
+        {
+            _handle = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (_handle < 0)
+                return false;
+
+            struct stat status{};
+            if (::fstat(_handle, &status) != 0)
+            {
+                ::close(_handle);
+                return false;
+            }
+            _file_size = static_cast<std::uint64_t>(status.st_size);
+            return _handle_valid = true;
+        }
+
+        void close() noexcept
+        {
+            if (_handle_valid)
+                ::close(_handle);
+            _handle_valid = false;
+        }
+
+        static auto allocation_granularity() noexcept -> std::uint64_t
+        {
+            return static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+        }
+
+        auto map_region(std::uint64_t offset, std::size_t length) const noexcept -> void *
+        {
+            void *mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, _handle, static_cast<off_t>(offset));
+            if (mapping == MAP_FAILED)
+                return nullptr;
+
+            ::madvise(mapping, length, MADV_SEQUENTIAL);
+            return mapping;
+        }
+
+        void unmap() noexcept
+        {
+            if (_mapping)
+                ::munmap(_mapping, _mapping_length);
+            reset_view();
+        }
+#endif
+
+        void reset_view() noexcept
+        {
+            _mapping = nullptr;
+            _mapping_length = 0;
+            _view = std::string_view{};
+        }
+
+        native_handle _handle{};
+        bool _handle_valid{};
+        bool _is_open{};
+        std::uint64_t _file_size{};
+        std::uint64_t _offset{};
+        void *_mapping{};
+        std::size_t _mapping_length{};
+        std::string_view _view{};
+    };
+
+    /**
+     * Finds all matches of a regex in a file by mapping it one window at a time.
+     * Consecutive windows overlap by the maximum width of the regex and the reach of its
+     * lookaround assertions, so matches which span window boundaries are reported once.
+     * The window which is already mapped is reused if it starts at the beginning of the file.
+     * Offsets are 64-bit even on 32-bit platforms, since files can be larger than the address space.
+     *
+     * @note If the regex has an unbounded width, the overlap is limited at runtime.
+     * A match which reaches the end of a window is searched again in the next window,
+     * but matches longer than a window are truncated to it.
+     *
+     * @note The match results passed to the function are invalidated when it returns.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @param file          The opened file
+     * @param func          The function invoked with each match and its offset in the file
+     * @param window_size   The maximum number of characters mapped at once
+     * @return              True if every window was mapped, false otherwise
+     */
+    template<typename Regex, typename Func>
+    requires std::invocable<Func &, typename stream_searcher<Regex>::result_type const &, std::uint64_t>
+    auto search_file(mapped_file &file, Func &func, std::size_t window_size = mapped_file::default_window) -> bool
+    {
+        using searcher = stream_searcher<Regex>;
+        using method = typename searcher::method;
+
+        std::size_t const lookahead = detail::limit_window(searcher::window_width);
+        std::size_t const lookbehind = detail::limit_window(searcher::lookbehind_reach);
+
+        // Each window must settle at least one position to make progress
+        window_size = (std::max)(window_size, lookahead + lookbehind + 1);
+
+        typename searcher::context_type ctx{};
+        std::uint64_t const file_size = file.file_size();
+        std::uint64_t position = 0;
+        for (;;)
+        {
+            std::uint64_t const window_begin = position > lookbehind ? position - lookbehind : 0;
+            auto const window_length = (std::min)(static_cast<std::uint64_t>(window_size), file_size - window_begin);
+            bool const is_mapped = file.is_open() && file.offset() == window_begin && file.size() == window_length;
+            if (!is_mapped && !file.map(window_begin, window_size))
+                return false;
+
+            std::string_view const input = file.view();
+            bool const is_last = window_begin + input.size() == file_size;
+            std::size_t const settled = is_last ? input.size() : input.size() - lookahead;
+            auto local_position = static_cast<std::size_t>(position - window_begin);
+            detail::search_settled<method>(input, local_position, settled, ctx, func, window_begin, false);
+
+            position = window_begin + local_position;
+            if (is_last)
+                return true;
+        }
+    }
+
+    /**
+     * Searches all matches of a regex inside a file and invokes a function for each one.
+     * The file is memory-mapped read-only and searched in place, without copying it.
+     * Files larger than the window size are mapped in overlapping windows, so matches
+     * which span the boundary between windows are still reported once.
+     *
+     * @note The match results passed to the function are invalidated when it returns.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @param path          The path of the file
+     * @param func          The function invoked with each non-empty match and its 64-bit offset in the file
+     * @param window_size   The maximum number of characters mapped at once
+     * @return              True if the file was opened and searched, false otherwise
+     */
+    template<typename Regex, typename Func>
+    requires std::invocable<Func &, typename stream_searcher<Regex>::result_type const &, std::uint64_t>
+    auto find_all_in_file(std::filesystem::path const &path, Func &&func, std::size_t window_size = mapped_file::default_window) -> bool
+    {
+        mapped_file file{path, window_size};
+        return file.is_open() && search_file<Regex>(file, func, window_size);
+    }
+}
+#endif //MREGEX_MAPPED_FILE_HPP
@@ -2,9 +2,12 @@
 #define MREGEX_MATCH_RESULT_HPP
 
 #include <iosfwd>
+#include <memory_resource>
 #include <optional>
 #include <tuple>
 #include <mregex/utility/tuple.hpp>
+#include <mregex/compact_match_result.hpp>
+#include <mregex/owning_match_result.hpp>
 #include <mregex/regex_capture_storage.hpp>
 
 namespace meta
@@ -31,11 +34,32 @@ namespace meta
 
     /**
      * Result that holds ownership of matched content.
+     * Each capturing group owns a separate copy of its content.
      *
-     * @tparam Regex    The regex type used for matching
+     * @tparam Regex        The regex type used for matching
+     * @tparam Allocator    The allocator used to store the matched content (optional)
+     */
+    template<typename Regex, typename Allocator = std::allocator<char>>
+    using match_result = basic_match_result<regex_capture_storage<Regex, Allocator>>;
+
+    /**
+     * Result that holds ownership of matched content in a single buffer.
+     * Capturing groups accessed through an lvalue are views into the buffer.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @tparam Allocator    The allocator used by the buffer (optional)
      */
-    template<typename Regex>
-    using match_result = basic_match_result<regex_capture_storage<Regex>>;
+    template<typename Regex, typename Allocator = std::allocator<char>>
+    using buffered_match_result = unpack_t<basic_owning_match_result, push_t<regex_capture_name_spec_t<Regex>, Allocator>>;
+
+    namespace pmr
+    {
+        template<typename Regex>
+        using match_result = meta::match_result<Regex, std::pmr::polymorphic_allocator<char>>;
+
+        template<typename Regex>
+        using buffered_match_result = meta::buffered_match_result<Regex, std::pmr::polymorphic_allocator<char>>;
+    }
 
     template<capture_storage CaptureStorage>
     struct basic_match_result
@@ -83,14 +107,74 @@ namespace meta
         [[nodiscard]] auto as_memory_owner() const
         requires is_view
         {
-            auto owned_captures = transform_groups([](auto const &capture) noexcept {
-                return regex_capture{capture};
-            });
+            return as_memory_owner(std::allocator<char>{});
+        }
 
+        /**
+         * Performs a deep copy of all regex captures using the given allocator.
+         *
+         * @param alloc The allocator used by the owned captures
+         * @return      A new match result object that holds ownership of captures
+         */
+        template<typename Allocator>
+        [[nodiscard]] auto as_memory_owner(Allocator const &alloc) const
+        requires is_view
+        {
+            auto owned_captures = transform_groups([&](auto const &capture) {
+                return regex_capture{capture, alloc};
+            });
             using owned_storage_type = std::remove_reference_t<decltype(owned_captures)>;
             return basic_match_result<owned_storage_type>{std::move(owned_captures), _matched};
         }
 
+        /**
+         * Copies the matched content into a single buffer and returns
+         * a new match result container that owns the memory.
+         *
+         * @note Unlike as_memory_owner(), groups of the new result accessed through an lvalue are
+         * views into its buffer, which are invalidated when the result is destroyed or assigned.
+         *
+         * @return  A new match result object that holds ownership of the buffer
+         */
+        [[nodiscard]] auto as_buffered_owner() const
+        requires is_view
+        {
+            return as_buffered_owner(std::allocator<char>{});
+        }
+
+        /**
+         * Copies the matched content into a single buffer which uses the given allocator.
+         *
+         * @param alloc The allocator used by the buffer
+         * @return      A new match result object that holds ownership of the buffer
+         */
+        template<typename Allocator>
+        [[nodiscard]] auto as_buffered_owner(Allocator const &alloc) const
+        requires is_view
+        {
+            using owning_result_type = decltype([]<typename Iter, typename... Names>(std::tuple<regex_capture_view<Iter, Names> ...> *) {
+                return basic_owning_match_result<Allocator, Names ...>{};
+            }(static_cast<capture_storage_type *>(nullptr)));
+
+            return owning_result_type{*this, alloc};
+        }
+
+        /**
+         * Stores all regex captures as offsets relative to a base iterator.
+         * The base is usually the beginning of the input, since captures made by
+         * lookbehinds may start before the match itself.
+         *
+         * @tparam Offset   The unsigned integral type used to store offsets
+         * @param base      The iterator all offsets are relative to
+         * @return          A new compact match result object
+         */
+        template<std::unsigned_integral Offset = std::uint32_t, std::random_access_iterator Iter>
+        [[nodiscard]] constexpr auto as_compact(Iter base) const noexcept
+        requires is_view
+        {
+            return basic_compact_match_result<capture_storage_type, Offset>{base, *this};
+        }
+
         /**
          * Converts the match result object to an instance of std::optional.
          * The returned optional will be empty if the regex did not match.
@@ -0,0 +1,167 @@
+#ifndef MREGEX_MATCH_RESULT_CURSOR_HPP
+#define MREGEX_MATCH_RESULT_CURSOR_HPP
+
+#include <iterator>
+#include <mregex/match_result.hpp>
+#include <mregex/regex_match_context.hpp>
+#include <mregex/regex_methods.hpp>
+
+namespace meta
+{
+    /**
+     * A cursor that iterates all results of a regex method over a forward range.
+     * Unlike match_result_generator, the cursor reuses a single match context and
+     * exposes the current result in place, without constructing a new result for each step.
+     * At most one empty result will be generated.
+     *
+     * @note Groups obtained from the cursor are invalidated when the cursor advances.
+     * Use result() to make a copy of the current match.
+     *
+     * @tparam Method   The regex method used to generate results
+     * @tparam Iter     The forward iterator type used to access the input
+     */
+    template<typename Method, std::forward_iterator Iter>
+    struct match_result_cursor
+    {
+        using method = Method;
+        using iterator = Iter;
+        using regex_type = typename method::regex_type;
+        using context_type = regex_match_context<regex_type, iterator>;
+        using result_type = match_result_view<regex_type, iterator>;
+
+        static constexpr std::size_t group_count = result_type::group_count;
+
+        constexpr match_result_cursor(iterator begin, iterator end) noexcept
+            : _begin{begin}, _end{end}, _current{begin}
+        {
+            next();
+        }
+
+        /**
+         * Advances the cursor to the next result.
+         *
+         * @return  True if a new result was found, false otherwise
+         */
+        constexpr bool next() noexcept
+        {
+            if (!_active)
+                return _matched = false;
+
+            _ctx.reset();
+            auto result = method::invoke(_begin, _end, _current, _ctx);
+            _matched = result.matched;
+            _active = _matched && !get_group<0>(_ctx.captures).is_empty();
+            _current = result.end;
+            return _matched;
+        }
+
+        constexpr bool matched() const noexcept
+        {
+            return _matched;
+        }
+
+        constexpr auto length() const noexcept -> std::size_t
+        {
+            return get_group<0>(_ctx.captures).length();
+        }
+
+        /**
+         * Returns a copy of the current result which is not invalidated when the cursor advances.
+         */
+        [[nodiscard]] constexpr auto result() const noexcept -> result_type
+        {
+            return result_type{_ctx.captures, _matched};
+        }
+
+        template<std::size_t ID>
+        constexpr auto const &group() const noexcept
+        {
+            return get_group<ID>(_ctx.captures);
+        }
+
+        template<static_string Name>
+        constexpr auto const &group() const noexcept
+        {
+            return get_group<Name>(_ctx.captures);
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return _matched;
+        }
+
+        constexpr explicit(false) operator std::string_view() const noexcept
+        requires std::is_convertible_v<typename result_type::implicit_capture_type, std::string_view>
+        {
+            return static_cast<std::string_view>(group<0>());
+        }
+
+        struct input_iterator
+        {
+            using value_type = match_result_cursor<Method, Iter>;
+            using pointer = value_type const *;
+            using reference = value_type const &;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            constexpr input_iterator() noexcept = default;
+
+            constexpr explicit input_iterator(match_result_cursor &cursor) noexcept
+                : _target{&cursor}
+            {}
+
+            constexpr reference operator*() const noexcept
+            {
+                return *_target;
+            }
+
+            constexpr pointer operator->() const noexcept
+            {
+                return _target;
+            }
+
+            constexpr input_iterator &operator++() noexcept
+            {
+                _target->next();
+                return *this;
+            }
+
+            constexpr void operator++(int) noexcept
+            {
+                _target->next();
+            }
+
+            constexpr bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return !_target->matched();
+            }
+
+        private:
+            match_result_cursor *_target{nullptr};
+        };
+
+        /**
+         * Returns an input iterator which dereferences to the cursor itself.
+         *
+         * @return  An input iterator pointing to the current result
+         */
+        constexpr auto begin() noexcept
+        {
+            return input_iterator{*this};
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        iterator _begin;
+        iterator _end;
+        iterator _current;
+        context_type _ctx{};
+        bool _matched{};
+        bool _active{true};
+    };
+}
+#endif //MREGEX_MATCH_RESULT_CURSOR_HPP
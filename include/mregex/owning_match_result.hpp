@@ -0,0 +1,293 @@
+#ifndef MREGEX_OWNING_MATCH_RESULT_HPP
+#define MREGEX_OWNING_MATCH_RESULT_HPP
+
+#include <algorithm>
+#include <array>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <mregex/utility/tuple.hpp>
+#include <mregex/regex_capture_storage.hpp>
+
+namespace meta
+{
+    template<capture_storage CaptureStorage>
+    struct basic_match_result;
+
+    /**
+     * Result that holds ownership of the matched content in a single buffer.
+     * Capturing groups are stored as offsets into the buffer and are accessed as views.
+     *
+     * @note When the input is iterated with random access iterators, the buffer holds the span
+     * of input covered by all groups, so overlapping groups share their content.
+     * Otherwise, the content of each group is appended to the buffer.
+     *
+     * @tparam Allocator    The allocator used by the buffer
+     * @tparam Names        The names of all capturing groups
+     */
+    template<typename Allocator, typename... Names>
+    struct basic_owning_match_result
+    {
+        using allocator_type = Allocator;
+        using buffer_type = std::basic_string<char, std::char_traits<char>, Allocator>;
+        using view_iterator = std::string_view::const_iterator;
+        using capture_storage_type = std::tuple<regex_capture_view<view_iterator, Names> ...>;
+        using implicit_capture_type = std::tuple_element_t<0, capture_storage_type>;
+
+        static constexpr bool is_view = false;
+        static constexpr std::size_t group_count = sizeof...(Names);
+
+        // Offset of groups which never participated in the match
+        static constexpr std::size_t unset_offset = static_cast<std::size_t>(-1);
+
+        basic_owning_match_result() noexcept(noexcept(Allocator{})) = default;
+
+        template<capture_storage CaptureStorage>
+        explicit basic_owning_match_result(basic_match_result<CaptureStorage> const &result, Allocator const &alloc = Allocator{})
+            : _buffer{alloc}, _matched{result.matched()}
+        {
+            static_assert(std::tuple_size_v<CaptureStorage> == group_count, "capture count mismatch");
+
+            if (_matched)
+                copy_captures(result, std::make_index_sequence<group_count>{});
+        }
+
+        bool matched() const noexcept
+        {
+            return _matched;
+        }
+
+        auto length() const noexcept -> std::size_t
+        {
+            return group<0>().length();
+        }
+
+        auto begin() const noexcept
+        {
+            return group<0>().begin();
+        }
+
+        auto end() const noexcept
+        {
+            return group<0>().end();
+        }
+
+        /**
+         * Returns the buffer which holds the content of all capturing groups.
+         */
+        auto buffer() const noexcept -> buffer_type const &
+        {
+            return _buffer;
+        }
+
+        auto get_allocator() const noexcept -> allocator_type
+        {
+            return _buffer.get_allocator();
+        }
+
+        /**
+         * Converts the match result object to an instance of std::optional.
+         * The returned optional will be empty if the regex did not match.
+         *
+         * @return A new instance of std::optional that contains the match result object
+         */
+        [[nodiscard]] auto as_optional() const & -> std::optional<basic_owning_match_result>
+        {
+            if (!_matched)
+                return std::nullopt;
+            return std::optional{*this};
+        }
+
+        [[nodiscard]] auto as_optional() && noexcept -> std::optional<basic_owning_match_result>
+        {
+            if (!_matched)
+                return std::nullopt;
+            return std::optional{std::move(*this)};
+        }
+
+        /**
+         * Creates a new tuple by applying a function on each group of this match result.
+         *
+         * @param func  The function invoked to transform each capturing group
+         * @return      A new std::tuple that contains the transformed groups
+         */
+        template<typename Func>
+        [[nodiscard]] auto transform_groups(Func &&func) const
+        {
+            return transform_tuple(build_captures(std::make_index_sequence<group_count>{}), std::forward<Func>(func));
+        }
+
+        /**
+         * Invokes a function for each group of this match result.
+         *
+         * @param func  The function invoked on each capturing group
+         */
+        template<typename Func>
+        void for_each_group(Func &&func) const
+        {
+            iterate_tuple(build_captures(std::make_index_sequence<group_count>{}), std::forward<Func>(func));
+        }
+
+        /**
+         * Returns a view into the capturing group with the specified number.
+         * If this object is an expiring value, the content is copied into a regex_capture
+         * object which uses the same allocator, since the views would not outlive the buffer.
+         *
+         * @tparam ID   The number of the requested capturing group
+         * @return      The capturing group
+         */
+        template<std::size_t ID>
+        auto group() const & noexcept
+        {
+            static_assert(ID < group_count, "capturing group does not exist");
+            using capture_type = std::tuple_element_t<ID, capture_storage_type>;
+
+            std::size_t const begin_offset = _offsets[2 * ID];
+            if (begin_offset == unset_offset)
+                return capture_type{};
+
+            std::string_view const content{_buffer};
+            return capture_type{std::next(content.begin(), begin_offset), std::next(content.begin(), _offsets[2 * ID + 1])};
+        }
+
+        template<std::size_t ID>
+        auto group() const &&
+        {
+            auto const capture_view = group<ID>();
+            return regex_capture{capture_view, _buffer.get_allocator()};
+        }
+
+        /**
+         * Returns the capturing group with the specified name.
+         *
+         * @tparam Name The name of the requested capturing group
+         * @return      The capturing group
+         */
+        template<static_string Name>
+        auto group() const & noexcept
+        {
+            return group<name_index<Name>(std::make_index_sequence<group_count>{})>();
+        }
+
+        template<static_string Name>
+        auto group() const &&
+        {
+            return std::move(*this).template group<name_index<Name>(std::make_index_sequence<group_count>{})>();
+        }
+
+        /**
+         * Tuple-like interface for structured binding decomposition.
+         * The views remain valid as long as the decomposed object is alive.
+         */
+        template<std::size_t ID>
+        auto get() const noexcept
+        {
+            return group<ID>();
+        }
+
+        bool operator==(bool value) const noexcept
+        {
+            return _matched == value;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _matched;
+        }
+
+        explicit(false) operator std::string_view() const & noexcept
+        {
+            return static_cast<std::string_view>(group<0>());
+        }
+
+    private:
+        template<capture_storage CaptureStorage, std::size_t... IDs>
+        void copy_captures(basic_match_result<CaptureStorage> const &result, std::index_sequence<IDs ...>)
+        {
+            using iterator = decltype(result.template group<0>().begin());
+
+            if constexpr (std::random_access_iterator<iterator>)
+            {
+                // All groups are measured relative to the implicit group
+                iterator const origin = result.template group<0>().begin();
+                std::ptrdiff_t first = 0;
+                std::ptrdiff_t last = static_cast<std::ptrdiff_t>(result.length());
+                auto const extend = [&](auto const &capture) noexcept {
+                    if (!capture.matched())
+                        return;
+                    first = (std::min)(first, static_cast<std::ptrdiff_t>(std::distance(origin, capture.begin())));
+                    last = (std::max)(last, static_cast<std::ptrdiff_t>(std::distance(origin, capture.end())));
+                };
+                (extend(result.template group<IDs>()), ...);
+
+                _buffer.assign(std::next(origin, first), std::next(origin, last));
+                auto const store = [&]<std::size_t ID>(auto const &capture) noexcept {
+                    if (!capture.matched())
+                        return;
+                    _offsets[2 * ID] = static_cast<std::size_t>(std::distance(origin, capture.begin()) - first);
+                    _offsets[2 * ID + 1] = static_cast<std::size_t>(std::distance(origin, capture.end()) - first);
+                };
+                (store.template operator()<IDs>(result.template group<IDs>()), ...);
+            }
+            else
+            {
+                _buffer.reserve((result.template group<IDs>().length() + ...));
+                auto const append = [&]<std::size_t ID>(auto const &capture) {
+                    if (!capture.matched())
+                        return;
+                    _offsets[2 * ID] = _buffer.size();
+                    _buffer.append(capture.begin(), capture.end());
+                    _offsets[2 * ID + 1] = _buffer.size();
+                };
+                (append.template operator()<IDs>(result.template group<IDs>()), ...);
+            }
+        }
+
+        template<std::size_t... IDs>
+        auto build_captures(std::index_sequence<IDs ...>) const noexcept
+        {
+            return capture_storage_type{group<IDs>() ...};
+        }
+
+        template<static_string Name, std::size_t... IDs>
+        static constexpr auto name_index(std::index_sequence<IDs ...>) noexcept -> std::size_t
+        {
+            using capture_type = named_capture_type_for<capture_storage_type, Name>;
+
+            std::size_t index = group_count;
+            ((index = std::is_same_v<std::tuple_element_t<IDs, capture_storage_type>, capture_type> ? IDs : index), ...);
+            return index;
+        }
+
+        static constexpr auto make_unset_offsets() noexcept
+        {
+            std::array<std::size_t, 2 * group_count> offsets{};
+            offsets.fill(unset_offset);
+            return offsets;
+        }
+
+        buffer_type _buffer;
+        std::array<std::size_t, 2 * group_count> _offsets{make_unset_offsets()};
+        bool _matched{};
+    };
+}
+
+template<typename Allocator, typename... Names>
+std::ostream &operator<<(std::ostream &os, meta::basic_owning_match_result<Allocator, Names ...> const &result)
+{
+    return os << result.template group<0>();
+}
+
+template<typename Allocator, typename... Names>
+struct std::tuple_size<meta::basic_owning_match_result<Allocator, Names ...>>
+{
+    static constexpr std::size_t value = meta::basic_owning_match_result<Allocator, Names ...>::group_count;
+};
+
+template<size_t ID, typename Allocator, typename... Names>
+struct std::tuple_element<ID, meta::basic_owning_match_result<Allocator, Names ...>>
+{
+    using type = std::tuple_element_t<ID, typename meta::basic_owning_match_result<Allocator, Names ...>::capture_storage_type>;
+};
+#endif //MREGEX_OWNING_MATCH_RESULT_HPP
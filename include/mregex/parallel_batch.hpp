@@ -0,0 +1,106 @@
+#ifndef MREGEX_PARALLEL_BATCH_HPP
+#define MREGEX_PARALLEL_BATCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <mregex/batch_matcher.hpp>
+
+namespace meta
+{
+    /**
+     * Matches many short inputs exactly using multiple threads and writes one result for each of them.
+     * Threads repeatedly claim the next block of inputs, so a thread which finishes
+     * its blocks early continues with the blocks that were not claimed yet.
+     * Each thread reuses a single match context for all inputs it matches.
+     *
+     * @tparam Method   The regex method used for exact matching
+     * @tparam Result   The result type, either bool or a match result view
+     */
+    template<typename Method, typename Result>
+    struct parallel_batch_matcher
+    {
+        using batch_matcher_type = batch_matcher<Method, Result>;
+        using context_type = typename batch_matcher_type::context_type;
+        using result_type = Result;
+
+        // Number of consecutive inputs claimed at once by a thread
+        static constexpr std::size_t block_size = 256;
+
+        /**
+         * Matches all inputs using multiple threads.
+         *
+         * @param inputs        The inputs to be matched
+         * @param results       The results, which must have at least as many elements as the inputs (checked with an assertion)
+         * @param thread_count  The maximum number of threads, or 0 to use the hardware concurrency
+         */
+        static void match(std::span<std::string_view const> inputs, std::span<result_type> results, std::size_t thread_count)
+        {
+            assert(results.size() >= inputs.size());
+
+            if (thread_count == 0)
+                thread_count = (std::max)(std::thread::hardware_concurrency(), 1u);
+            std::size_t const block_count = (inputs.size() + block_size - 1) / block_size;
+            thread_count = (std::min)(thread_count, block_count);
+            if (thread_count <= 1)
+                return batch_matcher_type::match(inputs, results);
+
+            std::atomic<std::size_t> next_block{0};
+            auto const worker = [&] {
+                context_type ctx{};
+                for (std::size_t block; (block = next_block.fetch_add(1, std::memory_order_relaxed)) < block_count;)
+                {
+                    std::size_t const first = block * block_size;
+                    std::size_t const count = (std::min)(block_size, inputs.size() - first);
+                    batch_matcher_type::match(inputs.subspan(first, count), results.subspan(first, count), ctx);
+                }
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(thread_count - 1);
+            for (std::size_t i = 1; i < thread_count; ++i)
+                workers.emplace_back(worker);
+            worker();
+            for (auto &thread : workers)
+                thread.join();
+        }
+    };
+
+    /**
+     * Checks if each input of a batch matches a regex exactly, like test(), using multiple threads.
+     * Inputs are distributed dynamically in blocks, so threads which receive shorter inputs
+     * continue with the remaining blocks instead of waiting.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @param inputs        The inputs to be matched
+     * @param results       The output for each input, which must have at least as many elements as the inputs (checked with an assertion)
+     * @param thread_count  The maximum number of threads, or 0 to use the hardware concurrency
+     */
+    template<typename Regex>
+    void match_batch(std::span<std::string_view const> inputs, std::span<bool> results, std::size_t thread_count)
+    {
+        parallel_batch_matcher<typename Regex::test_method, bool>::match(inputs, results, thread_count);
+    }
+
+    /**
+     * Matches each input of a batch exactly and saves its capturing groups, like match(), using multiple threads.
+     * Inputs are distributed dynamically in blocks, so threads which receive shorter inputs
+     * continue with the remaining blocks instead of waiting.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @param inputs        The inputs to be matched
+     * @param results       The output for each input, which must have at least as many elements as the inputs (checked with an assertion)
+     * @param thread_count  The maximum number of threads, or 0 to use the hardware concurrency
+     */
+    template<typename Regex>
+    void match_batch(std::span<std::string_view const> inputs, std::span<typename Regex::batch_result_type> results, std::size_t thread_count)
+    {
+        using result_type = typename Regex::batch_result_type;
+        parallel_batch_matcher<typename Regex::match_method, result_type>::match(inputs, results, thread_count);
+    }
+}
+#endif //MREGEX_PARALLEL_BATCH_HPP
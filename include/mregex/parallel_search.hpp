@@ -0,0 +1,220 @@
+#ifndef MREGEX_PARALLEL_SEARCH_HPP
+#define MREGEX_PARALLEL_SEARCH_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <mregex/utility/concepts.hpp>
+#include <mregex/match_result.hpp>
+#include <mregex/regex_match_context.hpp>
+#include <mregex/regex_methods.hpp>
+
+namespace meta
+{
+    /**
+     * Finds all matches of a regex in a random access range by searching chunks of it on multiple threads.
+     * The results are identical to the ones generated sequentially by find_all().
+     *
+     * Each worker searches its chunk as if the sequential search started at the beginning of the chunk.
+     * Only matches which start inside the chunk are searched, but they are matched over the whole input,
+     * so matches which cross the end of a chunk are found regardless of the width of the regex.
+     * The chunks are merged in order on the calling thread.
+     * When the sequential search enters a chunk at a position where the worker did not search,
+     * it searches sequentially until it reaches a position where the worker would find the same match.
+     *
+     * @tparam Method   The regex method used to search
+     * @tparam Iter     The random access iterator type used to access the input
+     */
+    template<typename Method, std::random_access_iterator Iter>
+    struct parallel_search
+    {
+        using method = Method;
+        using regex_type = typename method::regex_type;
+        using context_type = regex_match_context<regex_type, Iter>;
+        using result_type = match_result_view<regex_type, Iter>;
+
+        // Smallest chunk searched by a separate thread
+        static constexpr std::size_t min_chunk_size = std::size_t{1} << 16;
+
+        /**
+         * Searches all matches of the regex inside the given range.
+         *
+         * @param begin         An iterator pointing to the start of the input
+         * @param end           An iterator pointing to the end of the input
+         * @param thread_count  The maximum number of threads, or 0 to use the hardware concurrency
+         * @param chunk_size    The smallest chunk searched by a separate thread
+         * @return              The matches in the order generated by find_all()
+         */
+        static auto find_all(Iter begin, Iter end, std::size_t thread_count, std::size_t chunk_size = min_chunk_size) -> std::vector<result_type>
+        {
+            if (thread_count == 0)
+                thread_count = (std::max)(std::thread::hardware_concurrency(), 1u);
+            auto const size = static_cast<std::size_t>(std::distance(begin, end));
+            std::size_t const chunk_count = std::clamp<std::size_t>(size / (std::max)(chunk_size, std::size_t{1}), 1, thread_count);
+
+            std::vector<Iter> bounds(chunk_count + 1);
+            for (std::size_t i = 0; i <= chunk_count; ++i)
+                bounds[i] = std::next(begin, static_cast<std::ptrdiff_t>(size / chunk_count * i));
+            bounds[chunk_count] = end;
+
+            std::vector<chunk_result> chunks(chunk_count);
+            std::vector<std::thread> workers;
+            workers.reserve(chunk_count - 1);
+            for (std::size_t i = 1; i < chunk_count; ++i)
+                workers.emplace_back([&, i] { search_chunk(begin, end, bounds[i], bounds[i + 1], chunks[i]); });
+            search_chunk(begin, end, bounds[0], bounds[1], chunks[0]);
+            for (auto &worker : workers)
+                worker.join();
+
+            return merge(begin, end, bounds, chunks);
+        }
+
+    private:
+        enum struct stop_reason
+        {
+            no_match,
+            empty_match,
+            chunk_end
+        };
+
+        /**
+         * Matches found by searching a chunk sequentially from its first position.
+         */
+        struct chunk_result
+        {
+            std::vector<result_type> matches;
+
+            // Position where the search which found each match started
+            std::vector<Iter> origins;
+
+            // Position where the search which ended the chunk started, or where it would have started
+            // if the last match ended after the chunk
+            Iter last_origin{};
+            stop_reason reason{};
+        };
+
+        static void search_chunk(Iter begin, Iter end, Iter chunk_begin, Iter chunk_end, chunk_result &chunk)
+        {
+            // Matches which start at the end of a chunk belong to the next one, except at the end of the input
+            bool const is_last_chunk = chunk_end == end;
+
+            context_type ctx{};
+            for (Iter current = chunk_begin;;)
+            {
+                chunk.last_origin = current;
+                if (!is_last_chunk && current >= chunk_end)
+                {
+                    chunk.reason = stop_reason::chunk_end;
+                    return;
+                }
+
+                ctx.reset();
+                if (!method::invoke(begin, end, current, chunk_end, ctx).matched)
+                {
+                    chunk.reason = is_last_chunk ? stop_reason::no_match : stop_reason::chunk_end;
+                    return;
+                }
+
+                auto const &match = get_group<0>(ctx.captures);
+                chunk.matches.emplace_back(ctx.captures, true);
+                chunk.origins.push_back(current);
+                if (match.is_empty())
+                {
+                    chunk.reason = stop_reason::empty_match;
+                    return;
+                }
+                current = match.end();
+            }
+        }
+
+        static auto merge(Iter begin, Iter end, std::vector<Iter> const &bounds, std::vector<chunk_result> &chunks) -> std::vector<result_type>
+        {
+            std::vector<result_type> results;
+            context_type ctx{};
+            Iter current = begin;
+            for (std::size_t i = 0; i != chunks.size(); ++i)
+            {
+                auto &chunk = chunks[i];
+                Iter const chunk_end = bounds[i + 1];
+                bool const is_last_chunk = chunk_end == end;
+
+                while (is_last_chunk || current < chunk_end)
+                {
+                    // A search from the current position finds the first match of the chunk which starts
+                    // at or after it, as long as the worker also searched from a position before it
+                    auto const next_match = std::partition_point(
+                            chunk.matches.begin(), chunk.matches.end(),
+                            [=](result_type const &match) { return match.template group<0>().begin() < current; }
+                    );
+                    auto const next_index = static_cast<std::size_t>(std::distance(chunk.matches.begin(), next_match));
+                    bool const is_synchronized = next_match != chunk.matches.end() ?
+                            chunk.origins[next_index] <= current :
+                            chunk.reason != stop_reason::empty_match && chunk.last_origin <= current;
+
+                    if (is_synchronized)
+                    {
+                        results.insert(results.end(), std::make_move_iterator(next_match), std::make_move_iterator(chunk.matches.end()));
+                        if (chunk.reason != stop_reason::chunk_end)
+                            return results;
+
+                        // No match starts between the last search position and the end of the chunk
+                        current = (std::max)(chunk.last_origin, chunk_end);
+                        break;
+                    }
+
+                    ctx.reset();
+                    if (!method::invoke(begin, end, current, chunk_end, ctx).matched)
+                    {
+                        if (is_last_chunk)
+                            return results;
+                        current = chunk_end;
+                        break;
+                    }
+
+                    auto const &match = get_group<0>(ctx.captures);
+                    results.emplace_back(ctx.captures, true);
+                    if (match.is_empty())
+                        return results;
+                    current = match.end();
+                }
+            }
+            return results;
+        }
+    };
+
+    /**
+     * Searches all matches of a regex inside the given range using multiple threads.
+     * The range is split into chunks which are searched in parallel and merged in order,
+     * so the result contains the same matches as find_all(begin, end), including the
+     * empty match which ends the search, if there is one.
+     * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+     *
+     * @tparam Regex        The regex type used for matching
+     * @param begin         An iterator pointing to the start of the sequence
+     * @param end           An iterator pointing to the end of the sequence
+     * @param thread_count  The maximum number of threads, or 0 to use the hardware concurrency
+     * @return              A vector which contains all matches
+     */
+    template<typename Regex, std::random_access_iterator Iter>
+    [[nodiscard]] auto find_all_parallel(Iter begin, Iter end, std::size_t thread_count = 0)
+    {
+        return parallel_search<regex_search_method<Regex>, Iter>::find_all(begin, end, thread_count);
+    }
+
+    template<typename Regex>
+    [[nodiscard]] auto find_all_parallel(std::string_view input, std::size_t thread_count = 0)
+    {
+        return find_all_parallel<Regex>(std::cbegin(input), std::cend(input), thread_count);
+    }
+
+    template<typename Regex, char_range Range>
+    requires std::ranges::random_access_range<Range const>
+    [[nodiscard]] auto find_all_parallel(Range const &input, std::size_t thread_count = 0)
+    {
+        return find_all_parallel<Regex>(std::cbegin(input), std::cend(input), thread_count);
+    }
+}
+#endif //MREGEX_PARALLEL_SEARCH_HPP
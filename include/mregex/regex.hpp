@@ -1,10 +1,24 @@
 #ifndef MREGEX_REGEX_HPP
 #define MREGEX_REGEX_HPP
 
+#include <algorithm>
+#include <string>
+#include <mregex/ast/passes/capture_stripping.hpp>
+#include <mregex/ast/optimization.hpp>
 #include <mregex/parser/parser.hpp>
 #include <mregex/utility/input_range_adapter.hpp>
+#include <mregex/utility/sentinel_iterator.hpp>
 #include <mregex/match_result.hpp>
+#include <mregex/batch_matcher.hpp>
+#include <mregex/capture_columns.hpp>
+#include <mregex/capture_conversion.hpp>
+#include <mregex/match_result_cursor.hpp>
 #include <mregex/match_result_generator.hpp>
+#include <mregex/line_range.hpp>
+#include <mregex/replace_format.hpp>
+#include <mregex/segmented_input.hpp>
+#include <mregex/split_range.hpp>
+#include <mregex/stream_searcher.hpp>
 #include <mregex/regex_flags.hpp>
 
 namespace meta
@@ -25,17 +39,38 @@ namespace meta
     requires (fail_on_syntax_error<Pattern>())
     using regex = regex_adapter<ast_of<Pattern>, Flags ...>;
 
+    namespace detail
+    {
+        /**
+         * Regex type used for matching when only a boolean result is needed.
+         * Its AST has no capturing groups, except the ones needed by backreferences.
+         * If no groups are left, the match context only stores the implicit group.
+         */
+        template<typename Regex>
+        struct stripped_regex
+        {
+            using stripped_ast_type = ast::strip_captures_t<regex_ast_t<Regex>>;
+            using ast_type = std::conditional_t<ast::capture_count<stripped_ast_type> == 0, stripped_ast_type, regex_ast_t<Regex>>;
+            using optimized_ast_type = ast::optimize_t<stripped_ast_type>;
+            using flags = regex_flags<Regex>;
+        };
+    }
+
     template<typename AST, regex_flag... Flags>
     struct regex_adapter
     {
         using self = regex_adapter<AST, Flags ...>;
         using ast_type = AST;
+        using optimized_ast_type = ast::optimize_t<ast_type>;
         using flags = regex_flag_sequence<Flags ...>;
 
         using match_method = regex_match_method<self>;
         using match_prefix_method = regex_match_prefix_method<self>;
         using search_method = regex_search_method<self>;
 
+        using test_method = regex_match_method<detail::stripped_regex<self>>;
+        using contains_method = regex_search_method<detail::stripped_regex<self>>;
+
         template<std::forward_iterator Iter>
         using tokenizer_type = match_result_generator<match_prefix_method, Iter>;
 
@@ -48,6 +83,19 @@ namespace meta
         template<std::forward_iterator Iter>
         using match_range_type = input_range_adapter<searcher_type<Iter>>;
 
+        template<std::forward_iterator Iter>
+        using cursor_type = match_result_cursor<search_method, Iter>;
+
+        template<std::forward_iterator Iter>
+        using split_range_type = split_range<contains_method, Iter>;
+
+        template<std::forward_iterator Iter, bool Inverted = false>
+        using line_range_type = line_range<contains_method, Iter, Inverted>;
+
+        using stream_searcher_type = stream_searcher<self>;
+
+        using batch_result_type = match_result_view<self, std::string_view::const_iterator>;
+
         /**
          * Metafunction used to add flags to the current regex type.
          *
@@ -107,6 +155,137 @@ namespace meta
             return invoke<search_method>(begin, end);
         }
 
+        /**
+         * Performs an exact match of the entire range and converts the capturing groups
+         * into the members of an aggregate, in order. Members are converted with the
+         * capture_conversion customization point, reading each group directly from the input.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @tparam Struct   The aggregate type that receives the converted groups
+         * @param begin     An iterator pointing to the start of the input
+         * @param end       An iterator pointing to the end of the input
+         * @return          The aggregate if the range matched and all conversions succeeded
+         */
+        template<typename Struct, std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto parse_into(Iter begin, Iter end) -> std::optional<Struct>
+        {
+            return convert_captures<Struct>(match(begin, end));
+        }
+
+        /**
+         * Checks if the entire range matches the pattern.
+         * This is equivalent to match(begin, end).matched(), but capturing groups are not
+         * saved unless a backreference needs them.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the input
+         * @param end   An iterator pointing to the end of the input
+         * @return      True if the range matches the pattern, false otherwise
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr bool test(Iter begin, Iter end) noexcept
+        {
+            return invoke_boolean<test_method>(begin, end);
+        }
+
+        /**
+         * Checks if each input of a batch matches the pattern exactly, like test().
+         * The match context is reused for all inputs, and inputs with a length that
+         * the pattern cannot match are rejected without running the matcher.
+         *
+         * @param inputs    The inputs to be matched
+         * @param results   The output for each input, which must have at least as many elements as the inputs (checked with an assertion)
+         */
+        static constexpr void match_batch(std::span<std::string_view const> inputs, std::span<bool> results) noexcept
+        {
+            batch_matcher<test_method, bool>::match(inputs, results);
+        }
+
+        /**
+         * Matches each input of a batch exactly and saves its capturing groups, like match().
+         *
+         * @param inputs    The inputs to be matched
+         * @param results   The output for each input, which must have at least as many elements as the inputs (checked with an assertion)
+         */
+        static constexpr void match_batch(std::span<std::string_view const> inputs, std::span<batch_result_type> results) noexcept
+        {
+            batch_matcher<match_method, batch_result_type>::match(inputs, results);
+        }
+
+        /**
+         * Checks if the given range contains a match for the pattern.
+         * This is equivalent to search(begin, end).matched(), but capturing groups are not
+         * saved unless a backreference needs them.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the input
+         * @param end   An iterator pointing to the end of the input
+         * @return      True if a match was found, false otherwise
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr bool contains(Iter begin, Iter end) noexcept
+        {
+            return invoke_boolean<contains_method>(begin, end);
+        }
+
+        /**
+         * Counts all matches inside the given range, without saving capturing groups.
+         * This is equivalent to the number of elements in find_all(begin, end),
+         * but no match result is constructed.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the input
+         * @param end   An iterator pointing to the end of the input
+         * @return      The number of matches
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto count(Iter begin, Iter end) noexcept -> std::size_t
+        {
+            regex_match_context<typename contains_method::regex_type, Iter> ctx{};
+            std::size_t match_count = 0;
+            for (Iter current = begin;; ++match_count)
+            {
+                ctx.reset();
+                auto result = contains_method::invoke(begin, end, current, ctx);
+                if (!result.matched)
+                    break;
+                if (get_group<0>(ctx.captures).is_empty())
+                    return match_count + 1;
+                current = result.end;
+            }
+            return match_count;
+        }
+
+        /**
+         * Counts the lines of the given range which contain at least one match.
+         * Each line is matched as a separate input, excluding its line feed.
+         * A final line feed does not start another line, and an empty range has no lines.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the input
+         * @param end   An iterator pointing to the end of the input
+         * @return      The number of matching lines
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto count_lines(Iter begin, Iter end) noexcept -> std::size_t
+        {
+            return line_range_type<Iter>{begin, end}.count();
+        }
+
+        /**
+         * Counts the lines of the given range which do not contain any match.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the input
+         * @param end   An iterator pointing to the end of the input
+         * @return      The number of non-matching lines
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto count_non_matching_lines(Iter begin, Iter end) noexcept -> std::size_t
+        {
+            return line_range_type<Iter, true>{begin, end}.count();
+        }
+
         /**
          * Returns a lazy tokenizer that yields all continuous matches inside the given range.
          * Continuous means that the tokenizer will stop at the first non-match position.
@@ -168,6 +347,267 @@ namespace meta
             return match_range_type<Iter>{searcher(begin, end)};
         }
 
+        /**
+         * Returns a cursor over all matches inside the given range.
+         * The cursor reuses one match context and exposes each match in place,
+         * so no result object is constructed while iterating.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the sequence
+         * @param end   An iterator pointing to the end of the sequence
+         * @return      A cursor positioned on the first match
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto cursor(Iter begin, Iter end) noexcept
+        {
+            return cursor_type<Iter>{begin, end};
+        }
+
+        /**
+         * Returns a lazy view of the segments of the given range which are separated by matches.
+         * Segments are views into the input and separators are searched without saving
+         * capturing groups. Empty matches are not treated as separators.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the sequence
+         * @param end   An iterator pointing to the end of the sequence
+         * @return      An input range which contains all segments between matches
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto split(Iter begin, Iter end) noexcept
+        {
+            return split_range_type<Iter>{begin, end};
+        }
+
+        /**
+         * Returns a lazy view of the lines of the given range which contain at least one match.
+         * Lines are separated by line feeds and each one is matched as a separate input.
+         * Candidate lines are found by scanning the whole input for characters which can
+         * start a match, so lines without candidates are never matched.
+         * Line feeds terminate lines like in grep, so there is no empty line after a final line feed.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the sequence
+         * @param end   An iterator pointing to the end of the sequence
+         * @return      An input range which contains all matching lines
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto matching_lines(Iter begin, Iter end) noexcept
+        {
+            return line_range_type<Iter>{begin, end};
+        }
+
+        /**
+         * Returns a lazy view of the lines of the given range which do not contain any match.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the sequence
+         * @param end   An iterator pointing to the end of the sequence
+         * @return      An input range which contains all non-matching lines
+         */
+        template<std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto non_matching_lines(Iter begin, Iter end) noexcept
+        {
+            return line_range_type<Iter, true>{begin, end};
+        }
+
+        /**
+         * Writes the capture offsets of all matches inside the given range into a sink.
+         * Offsets are relative to the beginning of the range, which allows storing the
+         * matches as a structure-of-arrays with one column per capturing group.
+         * The extraction stops early if the sink rejects a match.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @param begin An iterator pointing to the start of the sequence
+         * @param end   An iterator pointing to the end of the sequence
+         * @param sink  The object which consumes the offsets of each match
+         * @return      The number of extracted matches and whether the sink overflowed
+         */
+        template<std::random_access_iterator Iter, capture_offsets_sink<capture_count + 1> Sink>
+        static constexpr auto extract_all(Iter begin, Iter end, Sink &sink) -> extraction_status
+        {
+            extraction_status status{};
+            for (auto matches = cursor(begin, end); matches.matched(); matches.next())
+            {
+                if (!sink.push(detail::make_capture_offsets_row<capture_count + 1>(begin, matches)))
+                {
+                    status.overflow = true;
+                    break;
+                }
+                ++status.count;
+            }
+            return status;
+        }
+
+        /**
+         * Searches all matches inside a single-pass input range and invokes a function for each one.
+         * The input is read in chunks by a stream searcher, which only keeps a bounded window
+         * of characters in memory. Each match is passed with its offset from the start of the input.
+         *
+         * @note The match results passed to the function are invalidated when it returns.
+         *
+         * @param first An input iterator pointing to the start of the input
+         * @param last  A sentinel for the end of the input
+         * @param func  The function invoked with each non-empty match and its offset
+         */
+        template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel, typename Func>
+        requires std::invocable<Func &, typename stream_searcher_type::result_type const &, std::size_t>
+        static void for_each_match(Iter first, Sentinel last, Func &&func)
+        {
+            stream_searcher_type searcher;
+            searcher.feed(std::move(first), std::move(last), func);
+            searcher.finish(func);
+        }
+
+        /**
+         * Replaces the first match inside the given range and writes the output into an iterator.
+         * The format is parsed at compile-time and may reference capturing groups by number ($1)
+         * or by name ($<name>), while $$ writes a literal $.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @tparam Format   The replacement format
+         * @param begin     An iterator pointing to the start of the sequence
+         * @param end       An iterator pointing to the end of the sequence
+         * @param out       The output iterator
+         * @return          The output iterator past the last written character
+         */
+        template<static_string Format, std::forward_iterator Iter, std::output_iterator<char> Out>
+        static constexpr auto replace(Iter begin, Iter end, Out out) -> Out
+        {
+            auto const matches = cursor(begin, end);
+            if (!matches.matched())
+                return std::copy(begin, end, std::move(out));
+
+            auto const &match = matches.template group<0>();
+            out = std::copy(begin, match.begin(), std::move(out));
+            out = replace_format<self, Format>::write(matches, std::move(out));
+            return std::copy(match.end(), end, std::move(out));
+        }
+
+        /**
+         * Replaces all matches inside the given range and writes the output into an iterator.
+         * Matches are found in the same way as with find_all().
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @tparam Format   The replacement format
+         * @param begin     An iterator pointing to the start of the sequence
+         * @param end       An iterator pointing to the end of the sequence
+         * @param out       The output iterator
+         * @return          The output iterator past the last written character
+         */
+        template<static_string Format, std::forward_iterator Iter, std::output_iterator<char> Out>
+        static constexpr auto replace_all(Iter begin, Iter end, Out out) -> Out
+        {
+            Iter last = begin;
+            for (auto matches = cursor(begin, end); matches.matched(); matches.next())
+            {
+                auto const &match = matches.template group<0>();
+                out = std::copy(last, match.begin(), std::move(out));
+                out = replace_format<self, Format>::write(matches, std::move(out));
+                last = match.end();
+            }
+            return std::copy(last, end, std::move(out));
+        }
+
+        /**
+         * Computes the exact length of the output written by replace<Format>(begin, end, out).
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @tparam Format   The replacement format
+         * @param begin     An iterator pointing to the start of the sequence
+         * @param end       An iterator pointing to the end of the sequence
+         * @return          The number of characters in the output
+         */
+        template<static_string Format, std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto replace_size(Iter begin, Iter end) noexcept -> std::size_t
+        {
+            auto const input_length = static_cast<std::size_t>(std::distance(begin, end));
+            auto const matches = cursor(begin, end);
+            if (!matches.matched())
+                return input_length;
+            return input_length - matches.length() + replace_format<self, Format>::size(matches);
+        }
+
+        /**
+         * Computes the exact length of the output written by replace_all<Format>(begin, end, out).
+         * This allows reserving the output buffer before replacing.
+         * The supplied iterator pair must form a valid range, otherwise the behavior is undefined.
+         *
+         * @tparam Format   The replacement format
+         * @param begin     An iterator pointing to the start of the sequence
+         * @param end       An iterator pointing to the end of the sequence
+         * @return          The number of characters in the output
+         */
+        template<static_string Format, std::forward_iterator Iter>
+        [[nodiscard]] static constexpr auto replace_all_size(Iter begin, Iter end) noexcept -> std::size_t
+        {
+            auto output_length = static_cast<std::size_t>(std::distance(begin, end));
+            for (auto matches = cursor(begin, end); matches.matched(); matches.next())
+                output_length = output_length - matches.length() + replace_format<self, Format>::size(matches);
+            return output_length;
+        }
+
+        /**
+         * Overloads for working with iterator-sentinel pairs, such as null-terminated strings.
+         * The end of the input is found while matching, without computing the length first.
+         */
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto match(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return match(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto match_prefix(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return match_prefix(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto search(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return search(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr bool test(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return test(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr bool contains(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return contains(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto count(Iter begin, Sentinel end) noexcept -> std::size_t
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return count(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto find_all(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return find_all(first, last);
+        }
+
+        template<std::forward_iterator Iter, distinct_sentinel_for<Iter> Sentinel>
+        [[nodiscard]] static constexpr auto cursor(Iter begin, Sentinel end) noexcept
+        {
+            auto const [first, last] = make_sentinel_range(begin, end);
+            return cursor(first, last);
+        }
+
         /**
          * Overloads for working with string-like ranges directly.
          */
@@ -226,6 +666,73 @@ namespace meta
             return search(std::cbegin(input), std::cend(input)).as_memory_owner();
         }
 
+        template<typename Struct>
+        [[nodiscard]] static constexpr auto parse_into(std::string_view input) -> std::optional<Struct>
+        {
+            return parse_into<Struct>(std::cbegin(input), std::cend(input));
+        }
+
+        template<typename Struct, char_range Range>
+        [[nodiscard]] static constexpr auto parse_into(Range const &input) -> std::optional<Struct>
+        {
+            return parse_into<Struct>(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr bool test(std::string_view input) noexcept
+        {
+            return test(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr bool test(Range const &input) noexcept
+        {
+            return test(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr bool contains(std::string_view input) noexcept
+        {
+            return contains(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr bool contains(Range const &input) noexcept
+        {
+            return contains(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto count(std::string_view input) noexcept -> std::size_t
+        {
+            return count(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto count(Range const &input) noexcept -> std::size_t
+        {
+            return count(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto count_lines(std::string_view input) noexcept -> std::size_t
+        {
+            return count_lines(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto count_lines(Range const &input) noexcept -> std::size_t
+        {
+            return count_lines(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto count_non_matching_lines(std::string_view input) noexcept -> std::size_t
+        {
+            return count_non_matching_lines(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto count_non_matching_lines(Range const &input) noexcept -> std::size_t
+        {
+            return count_non_matching_lines(std::cbegin(input), std::cend(input));
+        }
+
         [[nodiscard]] static constexpr auto tokenizer(std::string_view input) noexcept
         {
             return tokenizer(std::cbegin(input), std::cend(input));
@@ -270,6 +777,136 @@ namespace meta
             return find_all(std::cbegin(input), std::cend(input));
         }
 
+        [[nodiscard]] static constexpr auto cursor(std::string_view input) noexcept
+        {
+            return cursor(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto cursor(Range const &input) noexcept
+        {
+            return cursor(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto split(std::string_view input) noexcept
+        {
+            return split(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto split(Range const &input) noexcept
+        {
+            return split(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto matching_lines(std::string_view input) noexcept
+        {
+            return matching_lines(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto matching_lines(Range const &input) noexcept
+        {
+            return matching_lines(std::cbegin(input), std::cend(input));
+        }
+
+        [[nodiscard]] static constexpr auto non_matching_lines(std::string_view input) noexcept
+        {
+            return non_matching_lines(std::cbegin(input), std::cend(input));
+        }
+
+        template<char_range Range>
+        [[nodiscard]] static constexpr auto non_matching_lines(Range const &input) noexcept
+        {
+            return non_matching_lines(std::cbegin(input), std::cend(input));
+        }
+
+        template<capture_offsets_sink<capture_count + 1> Sink>
+        static constexpr auto extract_all(std::string_view input, Sink &sink) -> extraction_status
+        {
+            return extract_all(std::cbegin(input), std::cend(input), sink);
+        }
+
+        template<char_range Range, capture_offsets_sink<capture_count + 1> Sink>
+        static constexpr auto extract_all(Range const &input, Sink &sink) -> extraction_status
+        {
+            return extract_all(std::cbegin(input), std::cend(input), sink);
+        }
+
+        template<static_string Format, std::output_iterator<char> Out>
+        static constexpr auto replace(std::string_view input, Out out) -> Out
+        {
+            return replace<Format>(std::cbegin(input), std::cend(input), std::move(out));
+        }
+
+        template<static_string Format, char_range Range, std::output_iterator<char> Out>
+        static constexpr auto replace(Range const &input, Out out) -> Out
+        {
+            return replace<Format>(std::cbegin(input), std::cend(input), std::move(out));
+        }
+
+        /**
+         * Two-pass overload that computes the exact size of the output before
+         * writing it, so the returned string is allocated only once.
+         */
+        template<static_string Format>
+        [[nodiscard]] static auto replace(std::string_view input) -> std::string
+        {
+            std::string output;
+            output.reserve(replace_size<Format>(input));
+            replace<Format>(input, std::back_inserter(output));
+            return output;
+        }
+
+        template<static_string Format>
+        [[nodiscard]] static constexpr auto replace_size(std::string_view input) noexcept -> std::size_t
+        {
+            return replace_size<Format>(std::cbegin(input), std::cend(input));
+        }
+
+        template<static_string Format, char_range Range>
+        [[nodiscard]] static constexpr auto replace_size(Range const &input) noexcept -> std::size_t
+        {
+            return replace_size<Format>(std::cbegin(input), std::cend(input));
+        }
+
+        template<static_string Format, std::output_iterator<char> Out>
+        static constexpr auto replace_all(std::string_view input, Out out) -> Out
+        {
+            return replace_all<Format>(std::cbegin(input), std::cend(input), std::move(out));
+        }
+
+        template<static_string Format, char_range Range, std::output_iterator<char> Out>
+        static constexpr auto replace_all(Range const &input, Out out) -> Out
+        {
+            return replace_all<Format>(std::cbegin(input), std::cend(input), std::move(out));
+        }
+
+        /**
+         * Two-pass overload that computes the exact size of the output before
+         * writing it, so the returned string is allocated only once.
+         */
+        template<static_string Format>
+        [[nodiscard]] static auto replace_all(std::string_view input) -> std::string
+        {
+            std::string output;
+            output.reserve(replace_all_size<Format>(input));
+            replace_all<Format>(input, std::back_inserter(output));
+            return output;
+        }
+
+        template<static_string Format>
+        [[nodiscard]] static constexpr auto replace_all_size(std::string_view input) noexcept -> std::size_t
+        {
+            return replace_all_size<Format>(std::cbegin(input), std::cend(input));
+        }
+
+        template<static_string Format, char_range Range>
+        [[nodiscard]] static constexpr auto replace_all_size(Range const &input) noexcept -> std::size_t
+        {
+            return replace_all_size<Format>(std::cbegin(input), std::cend(input));
+        }
+
     private:
         template<typename Method, std::forward_iterator Iter>
         static constexpr auto invoke(Iter begin, Iter end) noexcept
@@ -278,6 +915,13 @@ namespace meta
             auto result = Method::invoke(begin, end, begin, ctx);
             return match_result_view<self, Iter>{std::move(ctx.captures), result.matched};
         }
+
+        template<typename Method, std::forward_iterator Iter>
+        static constexpr bool invoke_boolean(Iter begin, Iter end) noexcept
+        {
+            regex_match_context<typename Method::regex_type, Iter> ctx{};
+            return Method::invoke(begin, end, begin, ctx).matched;
+        }
     };
 }
 #endif //MREGEX_REGEX_HPP
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define MREGEX_REGEX_CAPTURE_HPP
 
 #include <iterator>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <mregex/symbols/names.hpp>
@@ -51,12 +52,24 @@ namespace meta
         constexpr regex_capture_view() noexcept = default;
 
         constexpr explicit regex_capture_view(Iter begin, Iter end) noexcept
-            : _begin{begin}, _end{end}
+            : _begin{begin}, _end{end}, _matched{true}
         {}
 
+        /**
+         * Restores the state of a group which did not participate in the match.
+         */
         constexpr void clear() noexcept
         {
-            _end = _begin;
+            *this = regex_capture_view{};
+        }
+
+        /**
+         * Checks if the group participated in the match, even if it captured no characters.
+         * Value-initialized iterators are not compared, since that is undefined for most iterator types.
+         */
+        constexpr bool matched() const noexcept
+        {
+            return _matched;
         }
 
         constexpr bool is_empty() const noexcept
@@ -87,6 +100,18 @@ namespace meta
                 return std::string{_begin, _end};
         }
 
+        /**
+         * Copies the captured content into a string which uses the given allocator.
+         *
+         * @param alloc The allocator used by the returned string
+         * @return      A new string that holds the captured content
+         */
+        template<typename Allocator>
+        [[nodiscard]] constexpr auto content(Allocator const &alloc) const
+        {
+            return std::basic_string<char, std::char_traits<char>, Allocator>{_begin, _end, alloc};
+        }
+
         constexpr auto &operator[](std::size_t index) noexcept
         requires std::random_access_iterator<Iter>
         {
@@ -113,23 +138,47 @@ namespace meta
     private:
         Iter _begin{};
         Iter _end{};
+        bool _matched{};
     };
 
     /**
      * Class that holds ownership on the content captured by a regex group.
      *
-     * @tparam Name The name of the capturing group (optional)
+     * @tparam Name         The name of the capturing group (optional)
+     * @tparam Allocator    The allocator used to store the captured content (optional)
      */
-    template<typename Name = symbol::unnamed>
+    template<typename Name = symbol::unnamed, typename Allocator = std::allocator<char>>
     struct regex_capture : regex_capture_base<Name>
     {
-        regex_capture() noexcept = default;
+        using allocator_type = Allocator;
 
-        template<std::forward_iterator Iter>
-        explicit regex_capture(regex_capture_view<Iter, Name> const &capture_view)
-            : _capture{capture_view.begin(), capture_view.end()}
+        regex_capture() noexcept(noexcept(Allocator{})) = default;
+
+        explicit regex_capture(Allocator const &alloc) noexcept
+            : _capture{alloc}
         {}
 
+        template<std::forward_iterator Iter>
+        explicit regex_capture(regex_capture_view<Iter, Name> const &capture_view, Allocator const &alloc = Allocator{})
+            : _capture{alloc}, _matched{capture_view.matched()}
+        {
+            if (_matched)
+                _capture.assign(capture_view.begin(), capture_view.end());
+        }
+
+        auto get_allocator() const noexcept -> allocator_type
+        {
+            return _capture.get_allocator();
+        }
+
+        /**
+         * Checks if the group participated in the match, even if it captured no characters.
+         */
+        bool matched() const noexcept
+        {
+            return _matched;
+        }
+
         bool is_empty() const noexcept
         {
             return _capture.empty();
@@ -201,9 +250,16 @@ namespace meta
         }
 
     private:
-        std::string _capture;
+        std::basic_string<char, std::char_traits<char>, Allocator> _capture;
+        bool _matched{};
     };
 
+    namespace pmr
+    {
+        template<typename Name = symbol::unnamed>
+        using regex_capture = meta::regex_capture<Name, std::pmr::polymorphic_allocator<char>>;
+    }
+
     /**
      * Type trait used to check if a given capture type is an instance of
      * the regex_capture_view template.
@@ -231,10 +287,10 @@ namespace meta
         using type = regex_capture_view<Iter, Name>;
     };
 
-    template<typename OldName, typename Name>
-    struct rename_capture<regex_capture<OldName>, Name>
+    template<typename OldName, typename Allocator, typename Name>
+    struct rename_capture<regex_capture<OldName, Allocator>, Name>
     {
-        using type = regex_capture<Name>;
+        using type = regex_capture<Name, Allocator>;
     };
 
     template<captured_content Capture, typename Name>
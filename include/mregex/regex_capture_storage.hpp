@@ -14,10 +14,10 @@ namespace meta
             return std::tuple<regex_capture_view<Iter, Names> ...>{};
         }
 
-        template<typename... Names>
+        template<typename Allocator, typename... Names>
         constexpr auto make_regex_capture_storage(type_sequence<Names ...>) noexcept
         {
-            return std::tuple<regex_capture<Names> ...>{};
+            return std::tuple<regex_capture<Names, Allocator> ...>{};
         }
 
         template<typename T>
@@ -45,10 +45,11 @@ namespace meta
     /**
      * Storage type that holds memory-owning regex captures.
      *
-     * @tparam Regex    The regex type used for matching
+     * @tparam Regex        The regex type used for matching
+     * @tparam Allocator    The allocator used to store the captured content (optional)
      */
-    template<typename Regex>
-    using regex_capture_storage = decltype(detail::make_regex_capture_storage(regex_capture_name_spec_t<Regex>{}));
+    template<typename Regex, typename Allocator = std::allocator<char>>
+    using regex_capture_storage = decltype(detail::make_regex_capture_storage<Allocator>(regex_capture_name_spec_t<Regex>{}));
 
     template<capture_storage CaptureStorage, static_string Name>
     using named_capture_type_for = rename_capture_t<std::tuple_element_t<0, std::remove_reference_t<CaptureStorage>>, symbol::name<Name>>;
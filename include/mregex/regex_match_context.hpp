@@ -1,6 +1,7 @@
 #ifndef MREGEX_REGEX_MATCH_CONTEXT_HPP
 #define MREGEX_REGEX_MATCH_CONTEXT_HPP
 
+#include <mregex/utility/backtrack_stack.hpp>
 #include <mregex/utility/tuple.hpp>
 #include <mregex/regex_capture_storage.hpp>
 
@@ -21,14 +22,59 @@ namespace meta
         using ast_type = regex_ast_t<regex_type>;
         using flags = regex_flags<regex_type>;
 
+        /**
+         * Capturing groups which are stored only on the successful path of the match.
+         */
+        template<std::size_t ID>
+        static constexpr bool is_deferred_capture =
+                contains<ast::deferred_capture_spec_t<regex_optimized_ast_t<regex_type>>, std::integral_constant<std::size_t, ID>>;
+
         regex_capture_view_storage<regex_type, iterator> captures{};
 
+        // Positions saved by repetitions which backtrack without recursion
+        backtrack_stack<iterator> backtrack_positions{};
+
+        // One past the highest capturing group stored since the last reset
+        std::size_t capture_watermark{};
+
+        /**
+         * Records that a capturing group was stored, so that reset() clears it.
+         *
+         * @tparam ID   The number of the stored capturing group
+         */
+        template<std::size_t ID>
+        constexpr void mark_capture() noexcept
+        {
+            if (capture_watermark <= ID)
+                capture_watermark = ID + 1;
+        }
+
         constexpr void clear() noexcept
         {
             iterate_tuple(captures, [](auto &capture) noexcept {
                 capture.clear();
             });
         }
+
+        /**
+         * Restores the capturing groups touched by a previous match to their initial state,
+         * so that the context can be reused for another match.
+         * Only the implicit group and the groups below the watermark are visited.
+         */
+        constexpr void reset() noexcept
+        {
+            reset_captures(std::make_index_sequence<std::tuple_size_v<decltype(captures)>>{});
+            capture_watermark = 0;
+        }
+
+    private:
+        template<std::size_t... IDs>
+        constexpr void reset_captures(std::index_sequence<0, IDs ...>) noexcept
+        {
+            get_group<0>(captures) = {};
+            // Stops at the first group above the watermark
+            (void) ((IDs < capture_watermark && (get_group<IDs>(captures) = {}, true)) && ...);
+        }
     };
 }
 #endif //MREGEX_REGEX_MATCH_CONTEXT_HPP
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define MREGEX_REGEX_METHODS_HPP
 
 #include <mregex/ast/ast.hpp>
+#include <mregex/ast/first_set.hpp>
+#include <mregex/ast/optimization.hpp>
 #include <mregex/utility/continuations.hpp>
 #include <mregex/regex_capture.hpp>
 #include <mregex/regex_traits.hpp>
@@ -15,7 +17,7 @@ namespace meta
     struct regex_match_method
     {
         using regex_type = Regex;
-        using ast_type = regex_ast_t<regex_type>;
+        using ast_type = regex_optimized_ast_t<regex_type>;
 
         template<std::forward_iterator Iter, typename Context>
         static constexpr auto invoke(Iter begin, Iter end, Iter current, Context &ctx) noexcept -> ast::match_result<Iter>
@@ -33,7 +35,7 @@ namespace meta
     struct regex_match_prefix_method
     {
         using regex_type = Regex;
-        using ast_type = regex_ast_t<regex_type>;
+        using ast_type = regex_optimized_ast_t<regex_type>;
 
         template<std::forward_iterator Iter, typename Context>
         static constexpr auto invoke(Iter begin, Iter end, Iter current, Context &ctx) noexcept -> ast::match_result<Iter>
@@ -46,18 +48,40 @@ namespace meta
 
     /**
      * Method used for searching the first match in a range.
+     * Positions where the regex cannot start matching are skipped using its start set.
      */
     template<typename Regex>
     struct regex_search_method
     {
         using regex_type = Regex;
-        using ast_type = regex_ast_t<regex_type>;
+        using ast_type = regex_optimized_ast_t<regex_type>;
 
         template<std::forward_iterator Iter, typename Context>
         static constexpr auto invoke(Iter begin, Iter end, Iter current, Context &ctx) noexcept -> ast::match_result<Iter>
         {
+            return invoke(begin, end, current, end, ctx);
+        }
+
+        /**
+         * Searches the first match which starts before the given position, or at the end of the range
+         * if the position is the end. The match itself may extend up to the end of the range.
+         */
+        template<std::forward_iterator Iter, typename Context>
+        static constexpr auto invoke(Iter begin, Iter end, Iter current, Iter last, Context &ctx) noexcept -> ast::match_result<Iter>
+        {
+            constexpr char_set start_chars = ast::start_set<ast_type, typename Context::flags>;
+
             for (;; ++current)
             {
+                if constexpr (start_chars != char_set::full())
+                {
+                    // A regex that is not nullable cannot match an empty suffix
+                    current = find_in_set(current, last, start_chars);
+                    if (current == last)
+                        break;
+                }
+                else if (current == last && last != end)
+                    break;
                 if (auto result = ast_type::match(begin, end, current, ctx, continuations<Iter>::success))
                 {
                     get_group<0>(ctx.captures) = regex_capture_view<Iter>{current, result.end};
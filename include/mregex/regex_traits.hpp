@@ -10,6 +10,9 @@ namespace meta
     template<typename Regex>
     using regex_ast_t = typename Regex::ast_type;
 
+    template<typename Regex>
+    using regex_optimized_ast_t = typename Regex::optimized_ast_type;
+
     template<typename Regex>
     using regex_flags = typename Regex::flags;
 
@@ -25,6 +28,12 @@ namespace meta
     template<typename Regex, std::forward_iterator Iter>
     using regex_match_range_t = typename Regex::template match_range_type<Iter>;
 
+    template<typename Regex, std::forward_iterator Iter>
+    using regex_cursor_t = typename Regex::template cursor_type<Iter>;
+
+    template<typename Regex>
+    using regex_stream_searcher_t = typename Regex::stream_searcher_type;
+
     // Builds a capture name specification for the entire regex, including the implicit capturing group
     template<typename Regex>
     using regex_capture_name_spec_t = push_t<ast::capture_name_spec_t<regex_ast_t<Regex>>, symbol::unnamed>;
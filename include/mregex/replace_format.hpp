@@ -0,0 +1,203 @@
+#ifndef MREGEX_REPLACE_FORMAT_HPP
+#define MREGEX_REPLACE_FORMAT_HPP
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string_view>
+#include <mregex/regex_capture.hpp>
+#include <mregex/regex_traits.hpp>
+
+namespace meta
+{
+    /**
+     * Piece of a parsed replacement format.
+     * A piece is either a slice of the format string which is copied literally,
+     * or a reference to the capturing group with the given number.
+     */
+    struct format_piece
+    {
+        static constexpr std::size_t literal = static_cast<std::size_t>(-1);
+
+        std::size_t group{literal};
+        std::size_t begin{};
+        std::size_t end{};
+    };
+
+    namespace detail
+    {
+        template<std::size_t N>
+        struct parsed_format
+        {
+            std::array<format_piece, N> pieces{};
+            std::size_t count{};
+            bool valid{true};
+            bool groups_exist{true};
+
+            constexpr void add_literal(std::size_t begin, std::size_t end) noexcept
+            {
+                // Adjacent literals are merged to copy them in one step
+                if (count != 0 && pieces[count - 1].group == format_piece::literal && pieces[count - 1].end == begin)
+                    pieces[count - 1].end = end;
+                else
+                    pieces[count++] = format_piece{format_piece::literal, begin, end};
+            }
+
+            constexpr void add_group(std::size_t group, std::size_t group_count) noexcept
+            {
+                if (group >= group_count)
+                    groups_exist = false;
+                else
+                    pieces[count++] = format_piece{group};
+            }
+        };
+
+        template<typename... Names>
+        constexpr auto group_index_of(std::string_view name) noexcept -> std::size_t
+        {
+            std::size_t index = 0;
+            std::size_t result = sizeof...(Names);
+            ((result = regex_capture_base<Names>::has_name() && regex_capture_base<Names>::name() == name ? index : result, ++index), ...);
+            return result;
+        }
+
+        /**
+         * Parses a replacement format into a sequence of pieces.
+         * Groups are referenced by number ($1) or by name ($<name>), and $$ stands for a literal $.
+         *
+         * @tparam Format   The replacement format
+         * @tparam Names    The names of all capturing groups, including the implicit one
+         */
+        template<static_string Format, typename... Names>
+        constexpr auto parse_format(type_sequence<Names ...>) noexcept
+        {
+            constexpr std::size_t length = Format.length();
+            constexpr std::size_t group_count = sizeof...(Names);
+            std::string_view const format{Format};
+            parsed_format<length> result{};
+
+            for (std::size_t i = 0; i < length && result.valid;)
+            {
+                if (format[i] != '$')
+                {
+                    result.add_literal(i, i + 1);
+                    ++i;
+                    continue;
+                }
+                if (i + 1 == length)
+                {
+                    result.valid = false;
+                    break;
+                }
+
+                char const next = format[i + 1];
+                if (next == '$')
+                {
+                    result.add_literal(i + 1, i + 2);
+                    i += 2;
+                }
+                else if (next >= '0' && next <= '9')
+                {
+                    std::size_t group = 0;
+                    for (++i; i < length && format[i] >= '0' && format[i] <= '9'; ++i)
+                        group = (std::min)(group * 10 + static_cast<std::size_t>(format[i] - '0'), group_count);
+                    result.add_group(group, group_count);
+                }
+                else if (next == '<')
+                {
+                    std::size_t name_end = i + 2;
+                    while (name_end < length && format[name_end] != '>')
+                        ++name_end;
+                    if (name_end == length || name_end == i + 2)
+                    {
+                        result.valid = false;
+                        break;
+                    }
+                    result.add_group(group_index_of<Names ...>(format.substr(i + 2, name_end - i - 2)), group_count);
+                    i = name_end + 1;
+                }
+                else
+                {
+                    result.valid = false;
+                }
+            }
+            return result;
+        }
+    }
+
+    /**
+     * Replacement format parsed at compile-time against the capturing groups of a regex.
+     * Formatting a match unrolls into a sequence of copies, one for each piece of the format.
+     *
+     * @tparam Regex    The regex type used for matching
+     * @tparam Format   The replacement format
+     */
+    template<typename Regex, static_string Format>
+    struct replace_format
+    {
+        static constexpr auto parsed = detail::parse_format<Format>(regex_capture_name_spec_t<Regex>{});
+
+        static_assert(parsed.valid, "invalid replacement format");
+        static_assert(parsed.groups_exist, "capturing group does not exist");
+
+        static constexpr std::size_t piece_count = parsed.count;
+
+        /**
+         * Computes the exact length of the formatted output for a match.
+         *
+         * @param result    The match result or cursor which holds the captures
+         * @return          The number of characters written by write()
+         */
+        template<typename Result>
+        static constexpr auto size(Result const &result) noexcept -> std::size_t
+        {
+            return [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+                return (std::size_t{0} + ... + piece_size<Is>(result));
+            }(std::make_index_sequence<piece_count>{});
+        }
+
+        /**
+         * Writes the formatted output for a match into an output iterator.
+         *
+         * @param result    The match result or cursor which holds the captures
+         * @param out       The output iterator
+         * @return          The output iterator past the last written character
+         */
+        template<typename Result, std::output_iterator<char> Out>
+        static constexpr auto write(Result const &result, Out out) -> Out
+        {
+            return [&]<std::size_t... Is>(std::index_sequence<Is ...>) {
+                ((out = write_piece<Is>(result, std::move(out))), ...);
+                return out;
+            }(std::make_index_sequence<piece_count>{});
+        }
+
+    private:
+        template<std::size_t I, typename Result>
+        static constexpr auto piece_size(Result const &result) noexcept -> std::size_t
+        {
+            constexpr format_piece piece = parsed.pieces[I];
+            if constexpr (piece.group == format_piece::literal)
+                return piece.end - piece.begin;
+            else
+                return result.template group<piece.group>().length();
+        }
+
+        template<std::size_t I, typename Result, std::output_iterator<char> Out>
+        static constexpr auto write_piece(Result const &result, Out out) -> Out
+        {
+            constexpr format_piece piece = parsed.pieces[I];
+            if constexpr (piece.group == format_piece::literal)
+            {
+                std::string_view const format{Format};
+                return std::copy(format.begin() + piece.begin, format.begin() + piece.end, std::move(out));
+            }
+            else
+            {
+                auto const &capture = result.template group<piece.group>();
+                return std::copy(capture.begin(), capture.end(), std::move(out));
+            }
+        }
+    };
+}
+#endif //MREGEX_REPLACE_FORMAT_HPP
@@ -0,0 +1,280 @@
+#ifndef MREGEX_SEGMENTED_INPUT_HPP
+#define MREGEX_SEGMENTED_INPUT_HPP
+
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <mregex/utility/char_set.hpp>
+#include <mregex/regex_capture.hpp>
+
+namespace meta
+{
+    /**
+     * Bidirectional iterator over input which is stored in a sequence of contiguous segments,
+     * like rope buffers or scatter/gather I/O vectors.
+     * Empty segments are skipped, so the iterator always points to a character or to the end.
+     *
+     * Utilities which scan the input, like find_in_set and distance_less_than, have overloads
+     * that process one segment at a time and only handle the boundaries between segments.
+     */
+    struct segmented_iterator
+    {
+        using value_type = char;
+        using difference_type = std::ptrdiff_t;
+        using reference = char const &;
+        using pointer = char const *;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        constexpr segmented_iterator() noexcept = default;
+
+        constexpr segmented_iterator(std::string_view const *segment, std::string_view const *last_segment, std::size_t offset = 0) noexcept
+            : _segment{segment}, _last_segment{last_segment}, _offset{offset}
+        {
+            skip_empty_segments();
+        }
+
+        /**
+         * Returns the segment which contains the current character.
+         */
+        constexpr auto segment() const noexcept -> std::string_view const *
+        {
+            return _segment;
+        }
+
+        constexpr auto offset() const noexcept -> std::size_t
+        {
+            return _offset;
+        }
+
+        /**
+         * Returns an iterator to the first character of the next non-empty segment.
+         */
+        constexpr auto next_segment() const noexcept -> segmented_iterator
+        {
+            return segmented_iterator{_segment + 1, _last_segment};
+        }
+
+        constexpr reference operator*() const noexcept
+        {
+            return (*_segment)[_offset];
+        }
+
+        constexpr pointer operator->() const noexcept
+        {
+            return _segment->data() + _offset;
+        }
+
+        constexpr segmented_iterator &operator++() noexcept
+        {
+            if (++_offset == _segment->size())
+            {
+                ++_segment;
+                _offset = 0;
+                skip_empty_segments();
+            }
+            return *this;
+        }
+
+        constexpr segmented_iterator operator++(int) noexcept
+        {
+            auto old_iter = *this;
+            ++*this;
+            return old_iter;
+        }
+
+        constexpr segmented_iterator &operator--() noexcept
+        {
+            while (_offset == 0)
+            {
+                --_segment;
+                _offset = _segment->size();
+            }
+            --_offset;
+            return *this;
+        }
+
+        constexpr segmented_iterator operator--(int) noexcept
+        {
+            auto old_iter = *this;
+            --*this;
+            return old_iter;
+        }
+
+        friend constexpr bool operator==(segmented_iterator const &lhs, segmented_iterator const &rhs) noexcept
+        {
+            return lhs._segment == rhs._segment && lhs._offset == rhs._offset;
+        }
+
+        /**
+         * Scans each segment as a contiguous block of characters.
+         */
+        friend constexpr auto find_in_set(segmented_iterator current, segmented_iterator end, char_set const &set) noexcept -> segmented_iterator
+        {
+            while (current != end)
+            {
+                std::string_view const segment = *current._segment;
+                std::size_t const last = current._segment == end._segment ? end._offset : segment.size();
+                for (std::size_t i = current._offset; i != last; ++i)
+                {
+                    if (set.contains(segment[i]))
+                        return segmented_iterator{current._segment, current._last_segment, i};
+                }
+                if (current._segment == end._segment)
+                    return end;
+                current = current.next_segment();
+            }
+            return current;
+        }
+
+        /**
+         * Measures the distance one segment at a time.
+         */
+        friend constexpr bool distance_less_than(std::ptrdiff_t required_dist, segmented_iterator begin, segmented_iterator end) noexcept
+        {
+            auto const required = static_cast<std::size_t>(required_dist);
+            if (begin._segment == end._segment)
+                return end._offset - begin._offset < required;
+
+            std::size_t distance = begin._segment->size() - begin._offset;
+            auto segment = begin._segment + 1;
+            for (; segment != end._segment && distance < required; ++segment)
+                distance += segment->size();
+            if (segment == end._segment)
+                distance += end._offset;
+            return distance < required;
+        }
+
+        template<std::ptrdiff_t N>
+        friend constexpr bool distance_less_than(segmented_iterator begin, segmented_iterator end) noexcept
+        {
+            return distance_less_than(N, begin, end);
+        }
+
+    private:
+        constexpr void skip_empty_segments() noexcept
+        {
+            while (_segment != _last_segment && _segment->empty())
+                ++_segment;
+        }
+
+        std::string_view const *_segment{};
+        std::string_view const *_last_segment{};
+        std::size_t _offset{};
+    };
+
+    /**
+     * A forward range of characters stored in a sequence of segments.
+     * It can be passed to all regex methods that accept character ranges.
+     *
+     * @note The segments are not copied, so they must outlive the range and its iterators.
+     */
+    struct segmented_input
+    {
+        constexpr explicit segmented_input(std::span<std::string_view const> segments) noexcept
+            : _segments{segments}
+        {}
+
+        constexpr auto begin() const noexcept
+        {
+            return segmented_iterator{_segments.data(), _segments.data() + _segments.size()};
+        }
+
+        constexpr auto end() const noexcept
+        {
+            auto const last_segment = _segments.data() + _segments.size();
+            return segmented_iterator{last_segment, last_segment};
+        }
+
+    private:
+        std::span<std::string_view const> _segments;
+    };
+
+    /**
+     * A forward range of the contiguous pieces between two segmented iterators.
+     * Each piece is a view into one of the segments, so no characters are copied.
+     */
+    struct segment_view : std::ranges::view_interface<segment_view>
+    {
+        struct iterator
+        {
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr iterator(segmented_iterator current, segmented_iterator last) noexcept
+                : _current{current}, _last{last}
+            {}
+
+            constexpr value_type operator*() const noexcept
+            {
+                std::string_view const segment = *_current.segment();
+                std::size_t const piece_end = _current.segment() == _last.segment() ? _last.offset() : segment.size();
+                return segment.substr(_current.offset(), piece_end - _current.offset());
+            }
+
+            constexpr iterator &operator++() noexcept
+            {
+                if (_current.segment() == _last.segment())
+                    _current = _last;
+                else
+                    _current = _current.next_segment();
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                auto old_iter = *this;
+                ++*this;
+                return old_iter;
+            }
+
+            constexpr bool operator==(iterator const &other) const noexcept
+            {
+                return _current == other._current;
+            }
+
+        private:
+            segmented_iterator _current{};
+            segmented_iterator _last{};
+        };
+
+        constexpr segment_view() noexcept = default;
+
+        constexpr segment_view(segmented_iterator first, segmented_iterator last) noexcept
+            : _first{first}, _last{last}
+        {}
+
+        constexpr auto begin() const noexcept
+        {
+            return iterator{_first, _last};
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return iterator{_last, _last};
+        }
+
+    private:
+        segmented_iterator _first{};
+        segmented_iterator _last{};
+    };
+
+    /**
+     * Returns the content captured by a regex group as a list of contiguous pieces,
+     * without copying the content of groups which span multiple segments.
+     *
+     * @param capture   The capturing group
+     * @return          A forward range of string views
+     */
+    template<typename Name>
+    constexpr auto capture_segments(regex_capture_view<segmented_iterator, Name> const &capture) noexcept -> segment_view
+    {
+        return segment_view{capture.begin(), capture.end()};
+    }
+}
+#endif //MREGEX_SEGMENTED_INPUT_HPP
@@ -0,0 +1,142 @@
+#ifndef MREGEX_SPLIT_RANGE_HPP
+#define MREGEX_SPLIT_RANGE_HPP
+
+#include <iterator>
+#include <ranges>
+#include <mregex/regex_capture.hpp>
+#include <mregex/regex_match_context.hpp>
+
+namespace meta
+{
+    /**
+     * A lazy view of the segments of a forward range which are separated by regex matches.
+     * Segments are views into the input, so no memory is allocated for them.
+     * Empty matches of the separator are ignored, and the range always yields at least one segment.
+     *
+     * @tparam Method   The regex method used to search for separators
+     * @tparam Iter     The forward iterator type used to access the input
+     */
+    template<typename Method, std::forward_iterator Iter>
+    struct split_range : std::ranges::view_interface<split_range<Method, Iter>>
+    {
+        using method = Method;
+        using regex_type = typename method::regex_type;
+        using context_type = regex_match_context<regex_type, Iter>;
+        using value_type = regex_capture_view<Iter>;
+
+        constexpr split_range() noexcept = default;
+
+        constexpr split_range(Iter begin, Iter end) noexcept
+            : _begin{begin}, _end{end}, _segment_begin{begin}
+        {
+            next();
+        }
+
+        /**
+         * Advances the range to the next segment.
+         *
+         * @return  True if a new segment was found, false otherwise
+         */
+        constexpr bool next() noexcept
+        {
+            if (_last_segment)
+                return _active = false;
+
+            for (Iter current = _segment_begin;;)
+            {
+                _ctx.reset();
+                if (!method::invoke(_begin, _end, current, _ctx).matched)
+                    break;
+
+                auto const &separator = get_group<0>(_ctx.captures);
+                if (!separator.is_empty())
+                {
+                    _segment = value_type{_segment_begin, separator.begin()};
+                    _segment_begin = separator.end();
+                    return _active = true;
+                }
+                if (separator.begin() == _end)
+                    break;
+                current = std::next(separator.begin());
+            }
+
+            _segment = value_type{_segment_begin, _end};
+            _last_segment = true;
+            return _active = true;
+        }
+
+        constexpr auto const &segment() const noexcept
+        {
+            return _segment;
+        }
+
+        struct iterator
+        {
+            using value_type = typename split_range<Method, Iter>::value_type;
+            using pointer = value_type const *;
+            using reference = value_type const &;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr explicit iterator(split_range &range) noexcept
+                : _target{&range}
+            {}
+
+            constexpr reference operator*() const noexcept
+            {
+                return _target->segment();
+            }
+
+            constexpr pointer operator->() const noexcept
+            {
+                return &_target->segment();
+            }
+
+            constexpr iterator &operator++() noexcept
+            {
+                _target->next();
+                return *this;
+            }
+
+            constexpr void operator++(int) noexcept
+            {
+                _target->next();
+            }
+
+            constexpr bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return !_target->_active;
+            }
+
+        private:
+            split_range *_target{nullptr};
+        };
+
+        /**
+         * Returns an input iterator to the current segment.
+         *
+         * @return  An input iterator pointing to the current segment
+         */
+        constexpr auto begin() noexcept
+        {
+            return iterator{*this};
+        }
+
+        constexpr auto end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        Iter _begin{};
+        Iter _end{};
+        Iter _segment_begin{};
+        value_type _segment{};
+        context_type _ctx{};
+        bool _active{};
+        bool _last_segment{};
+    };
+}
+#endif //MREGEX_SPLIT_RANGE_HPP
@@ -0,0 +1,214 @@
+#ifndef MREGEX_STREAM_SEARCHER_HPP
+#define MREGEX_STREAM_SEARCHER_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <mregex/match_result.hpp>
+#include <mregex/regex_match_context.hpp>
+#include <mregex/regex_methods.hpp>
+
+namespace meta
+{
+    namespace detail
+    {
+        // Window used when the regex has an unbounded width and no limit is given
+        inline constexpr std::size_t default_window_limit = 4096;
+
+        constexpr auto limit_window(std::size_t width) noexcept -> std::size_t
+        {
+            return width != ast::unbounded_width ? width : default_window_limit;
+        }
+
+        /**
+         * Searches the matches of a window of input which start before the settled position.
+         * Positions which are not settled yet must be searched again when more input is available.
+         *
+         * If the regex has an unbounded width, a match which ends after the settled position
+         * could still grow with more input, so the search stops at its start instead of reporting it.
+         * When the window cannot grow, such a match is only held back if the search made progress,
+         * otherwise it is reported as it is.
+         *
+         * @param input     The window of input
+         * @param position  The position in the window where the search starts, updated after the search
+         * @param settled   The position in the window where unsettled matches start
+         * @param ctx       The match context
+         * @param func      The function invoked with each non-empty match and its offset
+         * @param offset    The offset of the window in the entire input, which determines the offset type
+         * @param can_grow  Whether the next window keeps the current one and appends more input
+         */
+        template<typename Method, typename Context, typename Func, std::unsigned_integral Offset>
+        void search_settled(
+                std::string_view input, std::size_t &position, std::size_t settled,
+                Context &ctx, Func &func, Offset offset, bool can_grow
+        )
+        {
+            using result_type = match_result_view<typename Method::regex_type, std::string_view::const_iterator>;
+
+            constexpr bool is_unbounded = ast::max_width<typename Method::ast_type> == ast::unbounded_width;
+            std::size_t const initial_position = position;
+            while (position < settled)
+            {
+                ctx.reset();
+                if (!Method::invoke(input.begin(), input.end(), std::next(input.begin(), position), ctx).matched)
+                    break;
+
+                auto const &match = get_group<0>(ctx.captures);
+                auto const match_position = static_cast<std::size_t>(std::distance(input.begin(), match.begin()));
+                if (match_position >= settled)
+                    break;
+
+                if constexpr (is_unbounded)
+                {
+                    if (match_position + match.length() > settled && (can_grow || match_position != initial_position))
+                    {
+                        position = match_position;
+                        return;
+                    }
+                }
+
+                if (match.is_empty())
+                {
+                    position = match_position + 1;
+                    continue;
+                }
+                func(result_type{ctx.captures, true}, offset + static_cast<Offset>(match_position));
+                position = match_position + match.length();
+            }
+            position = (std::max)(position, settled);
+        }
+    }
+
+    /**
+     * A push-based searcher that finds all matches of a regex in input which arrives in chunks.
+     * Matches which span the boundary between chunks are reported as if the input was contiguous.
+     *
+     * The searcher only carries over a bounded window of the input between chunks.
+     * A match is reported as soon as the data after its start position covers the maximum
+     * width of the regex and the characters inspected by its lookahead assertions.
+     * Characters inspected by lookbehind assertions are kept before the next search position.
+     *
+     * @note If the regex has an unbounded width, the window is limited at runtime.
+     * A match which reaches the last characters of the window is held back until more input
+     * arrives, so the buffer grows with the longest match and repetitions like \w+ are never split.
+     * Lookahead assertions which inspect more characters than the window limit after a match,
+     * and matches which cannot be found within the window, may still differ from contiguous input.
+     *
+     * @note Empty matches are not reported, since they would not consume any input.
+     *
+     * @tparam Regex    The regex type used for matching
+     */
+    template<typename Regex>
+    struct stream_searcher
+    {
+        using regex_type = Regex;
+        using ast_type = regex_ast_t<regex_type>;
+        using method = regex_search_method<regex_type>;
+        using iterator = std::string_view::const_iterator;
+        using context_type = regex_match_context<regex_type, iterator>;
+        using result_type = match_result_view<regex_type, iterator>;
+
+        static constexpr std::size_t lookbehind_reach = ast::lookbehind_reach<ast_type>;
+
+        // Characters that must follow a start position before a search from it cannot change
+        static constexpr std::size_t window_width = ast::detail::saturating_add(ast::max_width<ast_type>, ast::lookahead_reach<ast_type>);
+
+        // Number of characters read at once from input iterators
+        static constexpr std::size_t input_chunk_size = 4096;
+
+        stream_searcher() noexcept = default;
+
+        /**
+         * Constructs a searcher which carries over at most the given number of characters
+         * for lookahead and lookbehind, even if the regex could inspect more.
+         *
+         * @param window_limit  The maximum width of the carried over window
+         */
+        explicit stream_searcher(std::size_t window_limit) noexcept
+            : _window{(std::min)(window_width, window_limit)},
+              _lookbehind{(std::min)(lookbehind_reach, window_limit)}
+        {}
+
+        /**
+         * Appends a chunk to the stream and reports all matches which can no longer be
+         * changed by the data that follows.
+         *
+         * @note The match results passed to the function are invalidated when it returns.
+         *
+         * @param chunk The next part of the input
+         * @param func  The function invoked with each match and its offset in the stream
+         */
+        template<std::invocable<result_type const &, std::size_t> Func>
+        void feed(std::string_view chunk, Func &&func)
+        {
+            _buffer.append(chunk);
+            search_settled(func);
+        }
+
+        /**
+         * Reads all characters from a single-pass input range and reports the matches
+         * which can no longer be changed by the data that follows.
+         * The input is consumed in chunks, so it is never held in memory as a whole.
+         *
+         * @param first An input iterator pointing to the start of the input
+         * @param last  A sentinel for the end of the input
+         * @param func  The function invoked with each match and its offset in the stream
+         */
+        template<std::input_iterator InputIter, std::sentinel_for<InputIter> Sentinel, std::invocable<result_type const &, std::size_t> Func>
+        void feed(InputIter first, Sentinel last, Func &&func)
+        {
+            while (first != last)
+            {
+                for (std::size_t count = 0; count != input_chunk_size && first != last; ++count, ++first)
+                    _buffer.push_back(static_cast<char>(*first));
+                search_settled(func);
+            }
+        }
+
+        /**
+         * Marks the end of the stream and reports the remaining matches.
+         * The searcher is reset afterwards and can be reused for a new stream.
+         *
+         * @param func  The function invoked with each match and its offset in the stream
+         */
+        template<std::invocable<result_type const &, std::size_t> Func>
+        void finish(Func &&func)
+        {
+            detail::search_settled<method>(_buffer, _position, _buffer.size(), _ctx, func, _offset, true);
+            _buffer.clear();
+            _offset = 0;
+            _position = 0;
+        }
+
+        /**
+         * Returns the number of characters carried over between chunks.
+         */
+        auto buffered() const noexcept -> std::size_t
+        {
+            return _buffer.size();
+        }
+
+    private:
+        template<typename Func>
+        void search_settled(Func &func)
+        {
+            std::size_t const settled = _buffer.size() > _window ? _buffer.size() - _window : 0;
+            detail::search_settled<method>(_buffer, _position, settled, _ctx, func, _offset, true);
+
+            std::size_t const discarded = _position > _lookbehind ? _position - _lookbehind : 0;
+            _buffer.erase(0, discarded);
+            _offset += discarded;
+            _position -= discarded;
+        }
+
+        std::string _buffer;
+        context_type _ctx{};
+        std::size_t _window{detail::limit_window(window_width)};
+        std::size_t _lookbehind{detail::limit_window(lookbehind_reach)};
+        std::size_t _offset{};
+        std::size_t _position{};
+    };
+}
+#endif //MREGEX_STREAM_SEARCHER_HPP
@@ -0,0 +1,130 @@
+#ifndef MREGEX_UTILITY_BACKTRACK_STACK_HPP
+#define MREGEX_UTILITY_BACKTRACK_STACK_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace meta
+{
+    /**
+     * Growable LIFO container used to store backtracking points while matching.
+     * It is usable in constant expressions, since it only relies on std::allocator.
+     *
+     * @note Allocation failures are not recoverable during matching, since all matching
+     * functions are noexcept.
+     *
+     * @tparam T    The type of the stored elements
+     */
+    template<typename T>
+    struct backtrack_stack
+    {
+        static constexpr std::size_t initial_capacity = 16;
+
+        constexpr backtrack_stack() noexcept = default;
+
+        backtrack_stack(backtrack_stack const &) = delete;
+        backtrack_stack &operator=(backtrack_stack const &) = delete;
+
+        constexpr backtrack_stack(backtrack_stack &&other) noexcept
+            : _data{std::exchange(other._data, nullptr)},
+              _size{std::exchange(other._size, 0)},
+              _capacity{std::exchange(other._capacity, 0)}
+        {}
+
+        constexpr backtrack_stack &operator=(backtrack_stack &&other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                _data = std::exchange(other._data, nullptr);
+                _size = std::exchange(other._size, 0);
+                _capacity = std::exchange(other._capacity, 0);
+            }
+            return *this;
+        }
+
+        constexpr ~backtrack_stack()
+        {
+            release();
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        constexpr void push(T const &value) noexcept
+        {
+            if (_size == _capacity)
+                grow();
+            std::construct_at(_data + _size, value);
+            ++_size;
+        }
+
+        constexpr T pop() noexcept
+        {
+            --_size;
+            T value = std::move(_data[_size]);
+            std::destroy_at(_data + _size);
+            return value;
+        }
+
+        /**
+         * Removes elements until the size of the stack becomes the given one.
+         * The allocated memory is kept for reuse.
+         */
+        constexpr void shrink_to(std::size_t size) noexcept
+        {
+            while (_size > size)
+                std::destroy_at(_data + --_size);
+        }
+
+        constexpr void clear() noexcept
+        {
+            shrink_to(0);
+        }
+
+    private:
+        T *_data{};
+        std::size_t _size{};
+        std::size_t _capacity{};
+
+        constexpr void grow() noexcept
+        {
+            std::allocator<T> allocator;
+            std::size_t const new_capacity = _capacity == 0 ? initial_capacity : 2 * _capacity;
+            T *new_data = allocator.allocate(new_capacity);
+            for (std::size_t i = 0; i != _size; ++i)
+            {
+                std::construct_at(new_data + i, std::move(_data[i]));
+                std::destroy_at(_data + i);
+            }
+            if (_data)
+                allocator.deallocate(_data, _capacity);
+            _data = new_data;
+            _capacity = new_capacity;
+        }
+
+        constexpr void release() noexcept
+        {
+            if (!_data)
+                return;
+            clear();
+            std::allocator<T>{}.deallocate(_data, _capacity);
+            _data = nullptr;
+            _capacity = 0;
+        }
+    };
+}
+#endif //MREGEX_UTILITY_BACKTRACK_STACK_HPP
@@ -0,0 +1,89 @@
+#ifndef MREGEX_UTILITY_CHAR_SET_HPP
+#define MREGEX_UTILITY_CHAR_SET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace meta
+{
+    /**
+     * Fixed-size bitset with one bit for each of the 256 possible values of a byte.
+     */
+    struct char_set
+    {
+        static constexpr std::size_t size = 256;
+
+        std::array<std::uint64_t, size / 64> words{};
+
+        static constexpr char_set full() noexcept
+        {
+            char_set result;
+            for (auto &word : result.words)
+                word = ~std::uint64_t{0};
+            return result;
+        }
+
+        constexpr void insert(char input) noexcept
+        {
+            auto const byte = static_cast<std::uint8_t>(input);
+            words[byte / 64] |= std::uint64_t{1} << (byte % 64);
+        }
+
+        [[nodiscard]] constexpr bool contains(char input) const noexcept
+        {
+            auto const byte = static_cast<std::uint8_t>(input);
+            return (words[byte / 64] >> (byte % 64)) & 1;
+        }
+
+        [[nodiscard]] constexpr bool is_empty() const noexcept
+        {
+            for (auto word : words)
+            {
+                if (word != 0)
+                    return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool intersects(char_set const &other) const noexcept
+        {
+            return !(*this & other).is_empty();
+        }
+
+        friend constexpr char_set operator|(char_set lhs, char_set const &rhs) noexcept
+        {
+            for (std::size_t i = 0; i < lhs.words.size(); ++i)
+                lhs.words[i] |= rhs.words[i];
+            return lhs;
+        }
+
+        friend constexpr char_set operator&(char_set lhs, char_set const &rhs) noexcept
+        {
+            for (std::size_t i = 0; i < lhs.words.size(); ++i)
+                lhs.words[i] &= rhs.words[i];
+            return lhs;
+        }
+
+        friend constexpr bool operator==(char_set const &, char_set const &) noexcept = default;
+    };
+
+    /**
+     * Finds the first character of a range which belongs to the given set.
+     * Iterators over non-contiguous storage may provide a faster overload, which is found through ADL.
+     *
+     * @param current   An iterator pointing to the start of the range
+     * @param end       An iterator pointing to the end of the range
+     * @param set       The set of characters to find
+     * @return          An iterator to the first character in the set, or the end of the range
+     */
+    template<std::forward_iterator Iter>
+    constexpr auto find_in_set(Iter current, Iter end, char_set const &set) noexcept -> Iter
+    {
+        while (current != end && !set.contains(*current))
+            ++current;
+        return current;
+    }
+}
+#endif //MREGEX_UTILITY_CHAR_SET_HPP
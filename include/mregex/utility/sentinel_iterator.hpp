@@ -0,0 +1,140 @@
+#ifndef MREGEX_UTILITY_SENTINEL_ITERATOR_HPP
+#define MREGEX_UTILITY_SENTINEL_ITERATOR_HPP
+
+#include <concepts>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace meta
+{
+    /**
+     * Sentinel which marks the end of a null-terminated sequence of characters.
+     * Comparing it with an iterator only inspects the current character, so the
+     * length of the sequence does not have to be computed before matching.
+     */
+    struct null_terminator_t
+    {
+        template<std::input_iterator Iter>
+        friend constexpr bool operator==(Iter const &current, null_terminator_t) noexcept(noexcept(*current))
+        {
+            return *current == std::iter_value_t<Iter>{};
+        }
+    };
+
+    inline constexpr null_terminator_t null_terminator{};
+
+    /**
+     * Concept used to constrain a sentinel type which is different from the iterator type.
+     */
+    template<typename Sentinel, typename Iter>
+    concept distinct_sentinel_for = std::sentinel_for<Sentinel, Iter> && !std::same_as<Sentinel, Iter>;
+
+    /**
+     * Iterator adapter that turns an iterator-sentinel pair into a pair of iterators with the same type.
+     * The end of the range is represented by a special iterator which compares equal to every
+     * iterator that reached the sentinel, so the end position is found lazily while matching.
+     *
+     * @note The end iterator cannot be dereferenced or decremented.
+     *
+     * @tparam Iter     The forward iterator type used to access the input
+     * @tparam Sentinel The sentinel type which marks the end of the input
+     */
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    struct sentinel_iterator
+    {
+        using value_type = std::iter_value_t<Iter>;
+        using difference_type = std::iter_difference_t<Iter>;
+        using reference = std::iter_reference_t<Iter>;
+        using iterator_concept = std::conditional_t<
+                std::bidirectional_iterator<Iter>,
+                std::bidirectional_iterator_tag,
+                std::forward_iterator_tag
+        >;
+        using iterator_category = iterator_concept;
+
+        constexpr sentinel_iterator() noexcept = default;
+
+        constexpr explicit sentinel_iterator(Iter current) noexcept
+            : _current{current}
+        {}
+
+        /**
+         * Creates the iterator which marks the end of the input.
+         */
+        static constexpr auto end_of(Sentinel sentinel) noexcept -> sentinel_iterator
+        {
+            sentinel_iterator end;
+            end._sentinel = sentinel;
+            end._is_end = true;
+            return end;
+        }
+
+        constexpr auto base() const noexcept -> Iter
+        {
+            return _current;
+        }
+
+        constexpr reference operator*() const noexcept(noexcept(*_current))
+        {
+            return *_current;
+        }
+
+        constexpr sentinel_iterator &operator++() noexcept
+        {
+            ++_current;
+            return *this;
+        }
+
+        constexpr sentinel_iterator operator++(int) noexcept
+        {
+            auto old_iter = *this;
+            ++_current;
+            return old_iter;
+        }
+
+        constexpr sentinel_iterator &operator--() noexcept
+        requires std::bidirectional_iterator<Iter>
+        {
+            --_current;
+            return *this;
+        }
+
+        constexpr sentinel_iterator operator--(int) noexcept
+        requires std::bidirectional_iterator<Iter>
+        {
+            auto old_iter = *this;
+            --_current;
+            return old_iter;
+        }
+
+        friend constexpr bool operator==(sentinel_iterator const &lhs, sentinel_iterator const &rhs) noexcept
+        {
+            if (lhs._is_end)
+                return rhs._is_end || rhs._current == lhs._sentinel;
+            if (rhs._is_end)
+                return lhs._current == rhs._sentinel;
+            return lhs._current == rhs._current;
+        }
+
+    private:
+        Iter _current{};
+        [[no_unique_address]] Sentinel _sentinel{};
+        bool _is_end{};
+    };
+
+    /**
+     * Converts an iterator-sentinel pair into a pair of sentinel iterators.
+     *
+     * @param begin     An iterator pointing to the start of the input
+     * @param end       A sentinel for the end of the input
+     * @return          A pair of iterators that denote the same range
+     */
+    template<std::forward_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    constexpr auto make_sentinel_range(Iter begin, Sentinel end) noexcept
+    {
+        using iterator = sentinel_iterator<Iter, Sentinel>;
+        return std::pair<iterator, iterator>{iterator{begin}, iterator::end_of(end)};
+    }
+}
+#endif //MREGEX_UTILITY_SENTINEL_ITERATOR_HPP
@@ -1,6 +1,7 @@
 #ifndef MREGEX_UTILITY_TYPE_SEQUENCE_HPP
 #define MREGEX_UTILITY_TYPE_SEQUENCE_HPP
 
+#include <type_traits>
 #include <mregex/symbols/core.hpp>
 
 namespace meta
@@ -169,5 +170,54 @@ namespace meta
      */
     template<typename Sequence>
     using reverse_t = typename reverse<Sequence>::type;
+
+    template<template<typename...> typename Wrapper, typename Sequence>
+    struct unpack;
+
+    template<template<typename...> typename Wrapper, typename... Elems>
+    struct unpack<Wrapper, type_sequence<Elems ...>>
+    {
+        using type = Wrapper<Elems ...>;
+    };
+
+    /**
+     * Instantiates a variadic template with the elements of a type sequence.
+     */
+    template<template<typename...> typename Wrapper, typename Sequence>
+    using unpack_t = typename unpack<Wrapper, Sequence>::type;
+
+    /**
+     * Checks if a given type sequence contains a type.
+     */
+    template<typename Sequence, typename T>
+    inline constexpr bool contains = false;
+
+    template<typename... Elems, typename T>
+    inline constexpr bool contains<type_sequence<Elems ...>, T> = (std::is_same_v<Elems, T> || ...);
+
+    template<typename Sequence, typename Result = type_sequence<>>
+    struct unique
+    {
+        using type = Result;
+    };
+
+    template<typename First, typename... Rest, typename... Result>
+    struct unique<type_sequence<First, Rest ...>, type_sequence<Result ...>>
+    {
+        using next_result = std::conditional_t
+        <
+            contains<type_sequence<Result ...>, First>,
+            type_sequence<Result ...>,
+            type_sequence<Result ..., First>
+        >;
+
+        using type = typename unique<type_sequence<Rest ...>, next_result>::type;
+    };
+
+    /**
+     * Removes duplicate types from a type sequence, keeping only their first occurrence.
+     */
+    template<typename Sequence>
+    using unique_t = typename unique<Sequence>::type;
 }
 #endif //MREGEX_UTILITY_TYPE_SEQUENCE_HPP
\ No newline at end of file
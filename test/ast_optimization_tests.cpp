@@ -0,0 +1,209 @@
+#include <mregex.hpp>
+
+namespace meta::tests
+{
+    using namespace ast;
+
+    namespace
+    {
+        template<typename AST, typename Expected>
+        inline constexpr bool is_optimization_of = std::is_same_v<optimize_t<AST>, Expected>;
+
+        template<static_string Pattern, typename Expected>
+        inline constexpr bool is_optimized_ast_of = std::is_same_v<regex_optimized_ast_t<regex<Pattern>>, Expected>;
+    }
+
+    // Flattening
+    static_assert(is_optimization_of<sequence<literal<'a'>>, literal<'a'>>);
+    static_assert(is_optimization_of<alternation<star<literal<'a'>>>, star<literal<'a'>>>);
+    static_assert(
+        is_optimization_of
+        <
+            sequence<star<literal<'a'>>, sequence<star<literal<'b'>>, star<literal<'c'>>>>,
+            sequence<star<literal<'a'>>, star<literal<'b'>>, star<literal<'c'>>>
+        >
+    );
+    static_assert(
+        is_optimization_of
+        <
+            alternation<alternation<plus<digit>, plus<word>>, star<wildcard>>,
+            alternation<plus<digit>, plus<word>, star<wildcard>>
+        >
+    );
+    // Empty removal
+    static_assert(is_optimization_of<empty, empty>);
+    static_assert(is_optimization_of<sequence<empty, empty>, empty>);
+    static_assert(is_optimization_of<sequence<empty, plus<digit>, empty>, plus<digit>>);
+    static_assert(
+        is_optimization_of
+        <
+            alternation<sequence<empty, plus<digit>>, empty>,
+            alternation<plus<digit>, empty>
+        >
+    );
+    // Repetition folding
+    static_assert(is_optimization_of<fixed_repetition<3, fixed_repetition<2, wildcard>>, fixed_repetition<6, wildcard>>);
+    static_assert(is_optimization_of<fixed_repetition<2, lazy_fixed_repetition<2, wildcard>>, fixed_repetition<4, wildcard>>);
+    static_assert(is_optimization_of<fixed_repetition<1, plus<digit>>, plus<digit>>);
+    static_assert(is_optimization_of<fixed_repetition<0, plus<digit>>, empty>);
+    static_assert(is_optimization_of<fixed_repetition<0, unnamed_capture<1, digit>>, fixed_repetition<0, unnamed_capture<1, digit>>>);
+    static_assert(is_optimization_of<star<empty>, empty>);
+    static_assert(is_optimization_of<atomic<digit>, digit>);
+    static_assert(is_optimization_of<atomic<plus<digit>>, atomic<plus<digit>>>);
+    static_assert(
+        is_optimization_of
+        <
+            fixed_repetition<2, possessive_fixed_repetition<3, plus<digit>>>,
+            fixed_repetition<2, possessive_fixed_repetition<3, plus<digit>>>
+        >
+    );
+    // Set normalization
+    static_assert(is_optimization_of<set<digit>, digit>);
+    static_assert(is_optimization_of<set<digit, digit>, digit>);
+    static_assert(is_optimization_of<set<set<>>, nothing>);
+    static_assert(is_optimization_of<set<literal<'a'>, set<literal<'b'>, literal<'a'>>>, set<literal<'a'>, literal<'b'>>>);
+    static_assert(is_optimization_of<alternation<literal<'a'>, literal<'b'>>, set<literal<'a'>, literal<'b'>>>);
+    static_assert(is_optimization_of<negated<negated<digit>>, digit>);
+    static_assert(
+        is_optimization_of
+        <
+            whitespace,
+            set<literal<'\n'>, literal<'\r'>, literal<' '>, literal<'\t'>, literal<'\v'>, literal<'\f'>>
+        >
+    );
+    // Prefix factoring
+    static_assert(std::is_same_v<factor_prefixes_t<alternation<literal<'a'>, literal<'b'>>>, alternation<literal<'a'>, literal<'b'>>>);
+    static_assert(
+        std::is_same_v
+        <
+            factor_prefixes_t<alternation<sequence<literal<'a'>, literal<'b'>>, sequence<literal<'a'>, literal<'c'>>, literal<'d'>>>,
+            alternation<sequence<literal<'a'>, alternation<literal<'b'>, literal<'c'>>>, literal<'d'>>
+        >
+    );
+    static_assert(
+        std::is_same_v
+        <
+            factor_prefixes_t<alternation<literal<'a'>, sequence<literal<'a'>, literal<'b'>>>>,
+            sequence<literal<'a'>, alternation<empty, literal<'b'>>>
+        >
+    );
+    static_assert(
+        std::is_same_v
+        <
+            factor_prefixes_t<alternation<sequence<literal<'a'>, literal<'b'>>, literal<'c'>, sequence<literal<'a'>, literal<'d'>>>>,
+            alternation<sequence<literal<'a'>, literal<'b'>>, literal<'c'>, sequence<literal<'a'>, literal<'d'>>>
+        >
+    );
+    static_assert(
+        std::is_same_v
+        <
+            factor_prefixes_t<alternation<sequence<plus<literal<'a'>>, literal<'b'>>, sequence<plus<literal<'a'>>, literal<'c'>>>>,
+            alternation<sequence<plus<literal<'a'>>, literal<'b'>>, sequence<plus<literal<'a'>>, literal<'c'>>>
+        >
+    );
+    static_assert(
+        is_optimization_of
+        <
+            alternation<sequence<literal<'a'>, literal<'b'>>, sequence<literal<'a'>, literal<'c'>>>,
+            sequence<literal<'a'>, set<literal<'b'>, literal<'c'>>>
+        >
+    );
+    // Auto-possessification
+    static_assert(is_optimization_of<sequence<plus<digit>, literal<'-'>>, sequence<possessive_plus<digit>, literal<'-'>>>);
+    static_assert(is_optimization_of<sequence<lazy_star<lower>, literal<' '>>, sequence<possessive_star<lower>, literal<' '>>>);
+    static_assert(is_optimization_of<sequence<plus<digit>, optional<literal<'-'>>, literal<'x'>>, sequence<possessive_plus<digit>, possessive_optional<literal<'-'>>, literal<'x'>>>);
+    static_assert(is_optimization_of<sequence<plus<word>, literal<'a'>>, sequence<plus<word>, literal<'a'>>>);
+    static_assert(is_optimization_of<sequence<plus<lower>, literal<'A'>>, sequence<plus<lower>, literal<'A'>>>);
+    static_assert(is_optimization_of<sequence<plus<wildcard>, literal<'\n'>>, sequence<plus<wildcard>, literal<'\n'>>>);
+    static_assert(is_optimization_of<sequence<plus<digit>, optional<literal<'-'>>>, sequence<plus<digit>, optional<literal<'-'>>>>);
+    static_assert(is_optimization_of<sequence<plus<digit>, backref<1>>, sequence<plus<digit>, backref<1>>>);
+    static_assert(is_optimization_of<sequence<plus<digit>, end_of_input>, sequence<plus<digit>, end_of_input>>);
+    static_assert(is_optimization_of<sequence<plus<sequence<star<digit>, literal<'-'>>>, literal<'x'>>, sequence<plus<sequence<possessive_star<digit>, literal<'-'>>>, literal<'x'>>>);
+    static_assert(is_optimization_of<sequence<unnamed_capture<1, plus<digit>>, literal<'-'>>, sequence<unnamed_capture<1, possessive_plus<digit>>, literal<'-'>>>);
+    static_assert(is_optimization_of<sequence<plus<unnamed_capture<1, digit>>, literal<'-'>>, sequence<plus<unnamed_capture<1, digit>>, literal<'-'>>>);
+    static_assert(
+        is_optimization_of
+        <
+            positive_lookbehind<sequence<digit, plus<digit>, literal<'-'>>>,
+            positive_lookbehind<sequence<digit, plus<digit>, literal<'-'>>>
+        >
+    );
+    // Trivial run merging
+    static_assert(is_optimization_of<sequence<literal<'a'>, literal<'b'>>, sequence<literal<'a'>, literal<'b'>>>);
+    static_assert(
+        is_optimization_of
+        <
+            sequence<literal<'a'>, literal<'b'>, plus<digit>, literal<'c'>, word_boundary, literal<'d'>, literal<'e'>>,
+            sequence<sequence<literal<'a'>, literal<'b'>>, possessive_plus<digit>, literal<'c'>, word_boundary, sequence<literal<'d'>, literal<'e'>>>
+        >
+    );
+
+    // Capture stripping
+    static_assert(std::is_same_v<strip_captures_t<unnamed_capture<1, digit>>, digit>);
+    static_assert(
+        std::is_same_v
+        <
+            strip_captures_t<sequence<unnamed_capture<1, plus<unnamed_capture<2, digit>>>, backref<1>>>,
+            sequence<unnamed_capture<1, plus<digit>>, backref<1>>
+        >
+    );
+    static_assert(
+        std::is_same_v
+        <
+            strip_captures_t<sequence<unnamed_capture<1, digit>, named_capture<2, "x", word>, named_backref<"x">>>,
+            sequence<digit, named_capture<2, "x", word>, named_backref<"x">>
+        >
+    );
+    static_assert(std::is_same_v<backref_spec_t<ast_of<R"((a)(?<x>b)\1\k<x>)">>, type_sequence<std::integral_constant<std::size_t, 1>, symbol::name<"x">>>);
+
+    // Complete pipeline
+    static_assert(is_optimized_ast_of<R"((?:)(?:))", empty>);
+    static_assert(is_optimized_ast_of<R"((?:a{2}){3})", fixed_repetition<6, literal<'a'>>>);
+    static_assert(is_optimized_ast_of<R"([a-c\d]|[\da-c]|x)", set<digit, range<'a', 'c'>, literal<'x'>>>);
+    static_assert(
+        is_optimized_ast_of
+        <
+            R"(ab(?:c(?:de))+f)",
+            sequence
+            <
+                sequence<literal<'a'>, literal<'b'>>,
+                plus<sequence<literal<'c'>, literal<'d'>, literal<'e'>>>,
+                literal<'f'>
+            >
+        >
+    );
+    static_assert(
+        is_optimized_ast_of
+        <
+            R"((a|(?:b|c+))(?:)x{1})",
+            sequence
+            <
+                unnamed_capture<1, alternation<literal<'a'>, literal<'b'>, possessive_plus<literal<'c'>>>>,
+                literal<'x'>
+            >
+        >
+    );
+    static_assert(
+        is_optimized_ast_of
+        <
+            R"(error_code|error_msg|error_type)",
+            sequence
+            <
+                sequence<literal<'e'>, literal<'r'>, literal<'r'>, literal<'o'>, literal<'r'>, literal<'_'>>,
+                alternation
+                <
+                    sequence<literal<'c'>, literal<'o'>, literal<'d'>, literal<'e'>>,
+                    sequence<literal<'m'>, literal<'s'>, literal<'g'>>,
+                    sequence<literal<'t'>, literal<'y'>, literal<'p'>, literal<'e'>>
+                >
+            >
+        >
+    );
+    static_assert(
+        std::is_same_v
+        <
+            regex_optimized_ast_t<decltype(xpr::concat(xpr::str<"ab">, xpr::empty, xpr::exactly<2>(xpr::exactly<2>(xpr::digit))))>,
+            sequence<sequence<literal<'a'>, literal<'b'>>, fixed_repetition<4, digit>>
+        >
+    );
+}
@@ -10,6 +10,20 @@ namespace meta::tests
     {
         template<static_string Pattern, typename Expected>
         inline constexpr bool is_name_spec_of = std::is_same_v<capture_name_spec_t<ast_of<Pattern>>, Expected>;
+
+        constexpr char_set make_char_set(std::string_view chars) noexcept
+        {
+            char_set result;
+            for (char c : chars)
+                result.insert(c);
+            return result;
+        }
+
+        template<typename Node, typename Flags = regex_flag_sequence<>>
+        constexpr bool has_first_set(std::string_view chars, bool nullable) noexcept
+        {
+            return first_set<Node, Flags>::chars == make_char_set(chars) && first_set<Node, Flags>::nullable == nullable;
+        }
     }
 
     // Nodes which are trivially matchable by definition
@@ -120,4 +134,62 @@ namespace meta::tests
     static_assert(is_assertion<sequence<word_boundary, word>> == false);
     static_assert(is_assertion<negated<word>> == false);
     static_assert(is_assertion<plus<positive_lookahead<wildcard>>> == false);
-}
\ No newline at end of file
+    // FIRST sets
+    static_assert(has_first_set<literal<'a'>>("a", false));
+    static_assert(has_first_set<literal<'a'>, regex_flag_sequence<regex_flag::icase>>("aA", false));
+    static_assert(has_first_set<range<'0', '3'>>("0123", false));
+    static_assert(has_first_set<empty>("", true));
+    static_assert(has_first_set<word_boundary>("", true));
+    static_assert(has_first_set<sequence<word_boundary, literal<'a'>, literal<'b'>>>("a", false));
+    static_assert(has_first_set<sequence<optional<literal<'a'>>, literal<'b'>>>("ab", false));
+    static_assert(has_first_set<sequence<star<literal<'a'>>, optional<literal<'b'>>>>("ab", true));
+    static_assert(has_first_set<alternation<sequence<literal<'a'>, digit>, plus<literal<'b'>>>>("ab", false));
+    static_assert(has_first_set<alternation<literal<'a'>, empty>>("a", true));
+    static_assert(has_first_set<unnamed_capture<1, sequence<literal<'x'>, star<word>>>>("x", false));
+    static_assert(first_set<backref<1>, regex_flag_sequence<>>::chars == char_set::full());
+    static_assert(first_set<backref<1>, regex_flag_sequence<>>::nullable);
+    static_assert(first_set<wildcard, regex_flag_sequence<>>::chars.contains('\n') == false);
+    static_assert(first_set<wildcard, regex_flag_sequence<regex_flag::dotall>>::chars == char_set::full());
+    // Input widths
+    static_assert(min_width<literal<'a'>> == 1 && max_width<literal<'a'>> == 1);
+    static_assert(min_width<empty> == 0 && max_width<empty> == 0);
+    static_assert(min_width<word_boundary> == 0 && max_width<word_boundary> == 0);
+    static_assert(min_width<sequence<digit, optional<digit>, word_boundary>> == 1);
+    static_assert(max_width<sequence<digit, optional<digit>, word_boundary>> == 2);
+    static_assert(min_width<alternation<sequence<digit, digit>, plus<word>>> == 1);
+    static_assert(max_width<alternation<sequence<digit, digit>, plus<word>>> == unbounded_width);
+    static_assert(min_width<fixed_repetition<3, unnamed_capture<1, sequence<digit, digit>>>> == 6);
+    static_assert(max_width<repetition<symbol::quantifier_value<1>, symbol::quantifier_value<4>, sequence<digit, digit>>> == 8);
+    static_assert(max_width<star<empty>> == 0);
+    static_assert(min_width<backref<1>> == 0 && max_width<backref<1>> == unbounded_width);
+    // Characters inspected by assertions outside of a match
+    static_assert(lookbehind_reach<sequence<digit, plus<word>>> == 0 && lookahead_reach<sequence<digit, plus<word>>> == 0);
+    static_assert(lookbehind_reach<sequence<word_boundary, digit>> == 1 && lookahead_reach<sequence<word_boundary, digit>> == 1);
+    static_assert(lookbehind_reach<sequence<beginning_of_line, digit>> == 1 && lookahead_reach<sequence<beginning_of_line, digit>> == 0);
+    static_assert(lookbehind_reach<sequence<positive_lookbehind<sequence<digit, digit>>, word>> == 2);
+    static_assert(lookahead_reach<alternation<digit, negative_lookahead<sequence<word, end_of_input>>>> == 2);
+    static_assert(lookbehind_reach<unnamed_capture<1, star<positive_lookbehind<plus<word>>>>> == unbounded_width);
+    // Nodes which can be matched without continuations
+    static_assert(is_fixed_width_matchable<digit>);
+    static_assert(is_fixed_width_matchable<sequence<digit, literal<'-'>>>);
+    static_assert(is_fixed_width_matchable<alternation<sequence<digit, digit>, sequence<word, literal<'-'>>>>);
+    static_assert(is_fixed_width_matchable<fixed_repetition<2, sequence<digit, digit>>>);
+    static_assert(is_fixed_width_matchable<alternation<sequence<digit, digit>, digit>> == false);
+    static_assert(is_fixed_width_matchable<sequence<digit, unnamed_capture<1, digit>>> == false);
+    static_assert(is_fixed_width_matchable<sequence<digit, word_boundary>> == false);
+    // Nodes which can only end in one position
+    static_assert(is_deterministic<sequence<digit, digit>>);
+    static_assert(is_deterministic<alternation<sequence<literal<'\\'>, wildcard>, negated<set<literal<'\\'>, literal<'"'>>>>>);
+    static_assert(is_deterministic<sequence<possessive_plus<digit>, word_boundary, alternation<literal<'a'>, sequence<literal<'b'>, plus<digit>>>>> == false);
+    static_assert(is_deterministic<sequence<possessive_plus<digit>, word_boundary, alternation<literal<'a'>, sequence<literal<'b'>, possessive_plus<digit>>>>>);
+    static_assert(is_deterministic<alternation<sequence<literal<'a'>, literal<'b'>>, literal<'a'>>> == false);
+    static_assert(is_deterministic<alternation<sequence<literal<'a'>, literal<'b'>>, literal<'A'>>> == false);
+    static_assert(is_deterministic<alternation<empty, literal<'a'>>> == false);
+    static_assert(is_deterministic<star<digit>> == false);
+    // Capturing groups which can be stored after the match succeeded
+    static_assert(std::is_same_v<deferred_capture_spec_t<ast_of<R"((a)(b(c)))">>, type_sequence<std::integral_constant<std::size_t, 1>, std::integral_constant<std::size_t, 2>, std::integral_constant<std::size_t, 3>>>);
+    static_assert(std::is_same_v<deferred_capture_spec_t<alternation<unnamed_capture<1, literal<'a'>>, star<unnamed_capture<1, literal<'b'>>>>>, type_sequence<>>);
+    static_assert(std::is_same_v<deferred_capture_spec_t<ast_of<R"((a)(b)+(?=(c)))">>, type_sequence<std::integral_constant<std::size_t, 1>>>);
+    static_assert(std::is_same_v<deferred_capture_spec_t<ast_of<R"((a)(?<x>b)(c)\1\k<x>)">>, type_sequence<std::integral_constant<std::size_t, 3>>>);
+    static_assert(std::is_same_v<deferred_capture_spec_t<ast_of<R"((?>(a)))">>, type_sequence<>>);
+}
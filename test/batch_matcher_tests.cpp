@@ -0,0 +1,67 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <mregex.hpp>
+#include <mregex/parallel_batch.hpp>
+#include "runtime_tests.hpp"
+
+namespace meta::tests
+{
+    namespace
+    {
+        using kv_regex = regex<R"((\w+)=(\d{1,4}))">;
+
+        auto make_inputs(std::size_t count) -> std::vector<std::string>
+        {
+            std::vector<std::string> inputs;
+            inputs.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::string input;
+                switch (i % 5)
+                {
+                case 0: input.append("key").append(std::to_string(i)).append("=").append(std::to_string(i % 10000)); break;
+                case 1: input.append("=").append(std::to_string(i)); break;
+                case 2: input.append(i % 7, 'a').append("=12345"); break;
+                case 3: break;
+                default: input.append("v=").append(std::to_string(i % 100)); break;
+                }
+                inputs.push_back(std::move(input));
+            }
+            return inputs;
+        }
+
+        /**
+         * Matches a batch which spans several blocks with multiple threads and checks
+         * that every result is the one computed by matching each input separately.
+         */
+        bool has_threaded_batch_results()
+        {
+            auto const owned_inputs = make_inputs(2000);
+            std::vector<std::string_view> const inputs(owned_inputs.begin(), owned_inputs.end());
+
+            for (std::size_t thread_count : {0, 1, 2, 3, 8})
+            {
+                // std::vector<bool> cannot be viewed as a span
+                auto const tested = std::make_unique<bool[]>(inputs.size());
+                std::vector<kv_regex::batch_result_type> matched(inputs.size());
+                match_batch<kv_regex>(inputs, std::span<bool>{tested.get(), inputs.size()}, thread_count);
+                match_batch<kv_regex>(inputs, matched, thread_count);
+
+                for (std::size_t i = 0; i < inputs.size(); ++i)
+                {
+                    auto const expected = kv_regex::match(inputs[i]);
+                    if (tested[i] != expected.matched() || matched[i].matched() != expected.matched())
+                        return false;
+                    if (expected && (matched[i].group<1>().content() != expected.group<1>().content() || matched[i].group<2>().content() != expected.group<2>().content()))
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        register_runtime_test const threaded_batch_test{"match_batch with threads matches each input", &has_threaded_batch_results};
+    }
+}
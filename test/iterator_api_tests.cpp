@@ -1,4 +1,5 @@
 #include <mregex.hpp>
+#include <mregex/mapped_file.hpp>
 
 namespace meta::tests
 {
@@ -10,6 +11,32 @@ namespace meta::tests
             using pattern = regex<Pattern, Flags ...>;
             return pattern::match(sv.crbegin(), sv.crend()) == true;
         }
+
+        template<static_string Pattern, regex_flag... Flags>
+        constexpr bool match_c_string(char const *str)
+        {
+            using pattern = regex<Pattern, Flags ...>;
+            return pattern::match(str, null_terminator) == true;
+        }
+
+        template<static_string Pattern, std::size_t N>
+        constexpr auto search_segments(std::array<std::string_view, N> const &segments)
+        {
+            using pattern = regex<Pattern>;
+            return pattern::search(segmented_input{segments}).length();
+        }
+
+        constexpr bool has_expected_capture_segments()
+        {
+            std::array<std::string_view, 4> const segments{"key=va", "", "l", "ue;"};
+            auto const result = regex<R"(=(\w+);)">::search(segmented_input{segments});
+            auto const pieces = capture_segments(result.group<1>());
+            auto piece = pieces.begin();
+            bool const first = *piece++ == "va";
+            bool const second = *piece++ == "l";
+            bool const third = *piece++ == "ue";
+            return first && second && third && piece == pieces.end();
+        }
     }
 
     static_assert(match_reverse<R"()">(""));
@@ -35,4 +62,30 @@ namespace meta::tests
     static_assert(match_reverse<R"(a{2}c{1,3}b{1})">("baa") == false);
     static_assert(match_reverse<R"(a{2}c{1,3}b{1})">("bccca") == false);
     static_assert(match_reverse<R"((.+)ab\1)">("[ xyz]ba[xyz ]") == false);
-}
\ No newline at end of file
+
+    static_assert(std::bidirectional_iterator<sentinel_iterator<char const *, null_terminator_t>>);
+    static_assert(match_c_string<R"()">(""));
+    static_assert(match_c_string<R"(abc)">("abc"));
+    static_assert(match_c_string<R"(a{2}c{1,3}b)">("acccb") == false);
+    static_assert(match_c_string<R"(\w+\b(?<=lo))">("hello"));
+    static_assert(match_c_string<R"(^\d+$)">("12 3") == false);
+    static_assert(match_c_string<R"((.+)-\1)">("xy-xy"));
+    static_assert(regex<R"(\d+)">::search("id: 1234 ", null_terminator).length() == 4);
+    static_assert(regex<R"(\d+)">::match_prefix("12ab", null_terminator).length() == 2);
+    static_assert(regex<R"(\w+)">::count("a bc d", null_terminator) == 3);
+    static_assert(regex<R"(\w+)">::contains(" !", null_terminator) == false);
+    static_assert(std::ranges::distance(regex<R"(\w+)">::find_all("a bc d", null_terminator)) == 3);
+
+    static_assert(std::bidirectional_iterator<segmented_iterator>);
+    static_assert(char_range<segmented_input>);
+    static_assert(std::ranges::forward_range<segment_view>);
+    static_assert(has_expected_capture_segments());
+    static_assert(search_segments<R"(abc)">(std::array<std::string_view, 3>{"xa", "b", "cx"}) == 3);
+    static_assert(search_segments<R"(\bword\b)">(std::array<std::string_view, 4>{"a wo", "", "rd", " b"}) == 4);
+    static_assert(search_segments<R"(\d{3}-\d{2})">(std::array<std::string_view, 3>{"id 12", "3-4", "5."}) == 6);
+    static_assert(search_segments<R"((?<=x)y+)">(std::array<std::string_view, 3>{"x", "yy", "y"}) == 3);
+    static_assert(search_segments<R"(z)">(std::array<std::string_view, 3>{"", "ab", ""}) == 0);
+    static_assert(std::ranges::contiguous_range<mapped_file const>);
+    static_assert(std::is_nothrow_move_constructible_v<mapped_file>);
+    static_assert(!std::is_copy_constructible_v<mapped_file>);
+}
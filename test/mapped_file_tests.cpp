@@ -0,0 +1,98 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <mregex.hpp>
+#include <mregex/mapped_file.hpp>
+#include "runtime_tests.hpp"
+
+namespace meta::tests
+{
+    namespace
+    {
+        using found_matches = std::vector<std::pair<std::uint64_t, std::string>>;
+
+        /**
+         * A file in the temporary directory which is removed when the object is destroyed.
+         */
+        struct temporary_file
+        {
+            std::filesystem::path path;
+
+            temporary_file(char const *name, std::string const &content)
+                : path{std::filesystem::temp_directory_path() / name}
+            {
+                std::ofstream{path, std::ios::binary} << content;
+            }
+
+            temporary_file(temporary_file const &) = delete;
+            temporary_file &operator=(temporary_file const &) = delete;
+
+            ~temporary_file()
+            {
+                std::error_code error;
+                std::filesystem::remove(path, error);
+            }
+        };
+
+        /**
+         * Searches a file with several window sizes and checks that the offsets and contents
+         * of the matches are the ones found by find_all() over the whole content.
+         */
+        template<static_string Pattern>
+        bool searches_file_like_find_all(std::string const &content)
+        {
+            found_matches expected;
+            for (auto const &match : regex<Pattern>::find_all(content))
+            {
+                if (match.length() != 0)
+                    expected.emplace_back(static_cast<std::uint64_t>(match.begin() - content.begin()), std::string{match.begin(), match.end()});
+            }
+
+            temporary_file const file{"mregex_mapped_file_test.txt", content};
+            for (std::size_t window_size : {1, 7, 16, 100, 5000})
+            {
+                found_matches actual;
+                bool const searched = find_all_in_file<regex<Pattern>>(file.path, [&](auto const &match, std::uint64_t offset) {
+                    actual.emplace_back(offset, std::string{match.begin(), match.end()});
+                }, window_size);
+
+                if (!searched || actual != expected)
+                    return false;
+            }
+            return true;
+        }
+
+        auto make_log(std::size_t line_count) -> std::string
+        {
+            std::string log;
+            for (std::size_t i = 0; i < line_count; ++i)
+                log += "id=" + std::to_string(i) + " tok_" + std::to_string(i * 7919 % 100000) + "; x" + std::to_string(i % 13) + '\n';
+            return log;
+        }
+
+        bool has_windowed_file_matches()
+        {
+            std::string const log = make_log(500);
+            return searches_file_like_find_all<R"(tok_\d{1,5})">(log) &&
+                   searches_file_like_find_all<R"(\btok_\w{1,8}(?=;))">(log) &&
+                   searches_file_like_find_all<R"((?<=x)\d{1,2})">(log) &&
+                   searches_file_like_find_all<R"(\d\Z)">("12 34 5") &&
+                   searches_file_like_find_all<R"(id=\d+)">(log);
+        }
+
+        bool has_no_matches_in_missing_file()
+        {
+            bool called = false;
+            bool const searched = find_all_in_file<regex<"a">>("mregex_missing_file.txt", [&](auto const &, std::uint64_t) {
+                called = true;
+            });
+            return !searched && !called;
+        }
+
+        register_runtime_test const windowed_file_test{"find_all_in_file finds the matches of find_all", &has_windowed_file_matches};
+        register_runtime_test const missing_file_test{"find_all_in_file reports missing files", &has_no_matches_in_missing_file};
+    }
+}
@@ -1,4 +1,6 @@
+#include <list>
 #include <mregex.hpp>
+#include "runtime_tests.hpp"
 
 namespace meta::tests
 {
@@ -28,6 +30,32 @@ namespace meta::tests
     static_assert(result_type::is_view);
     static_assert(result_type::group_count == 1);
 
+    static_assert(match_result<test_regex>::is_view == false);
+    static_assert(std::tuple_size_v<match_result<test_regex>> == 1);
+    static_assert(std::is_same_v<decltype(test_regex::match(std::string{})), match_result<test_regex>>);
+    static_assert(std::is_same_v<decltype(test_regex::match("").as_memory_owner()), match_result<test_regex>>);
+    static_assert(std::is_same_v<decltype(std::declval<match_result<test_regex> const &>().group<0>()), regex_capture<> const &>);
+    static_assert(std::is_same_v<decltype(pmr::match_result<test_regex>{}.group<0>()), pmr::regex_capture<> &&>);
+    static_assert(
+        std::is_same_v
+        <
+            decltype(test_regex::match("").as_memory_owner(std::pmr::polymorphic_allocator<char>{})),
+            pmr::match_result<test_regex>
+        >
+    );
+
+    static_assert(buffered_match_result<test_regex>::is_view == false);
+    static_assert(std::is_same_v<decltype(test_regex::match("").as_buffered_owner()), buffered_match_result<test_regex>>);
+    static_assert(
+        std::is_same_v
+        <
+            decltype(std::declval<buffered_match_result<test_regex> const &>().group<0>()),
+            regex_capture_view<std::string_view::const_iterator>
+        >
+    );
+    static_assert(std::is_same_v<decltype(buffered_match_result<test_regex>{}.group<0>()), regex_capture<>>);
+    static_assert(std::is_same_v<decltype(pmr::buffered_match_result<test_regex>{}.group<0>()), pmr::regex_capture<>>);
+
     static_assert(is_expected_match(test_regex::match("test")));
     static_assert(is_expected_non_match(test_regex::match("xxx")));
 
@@ -36,4 +64,128 @@ namespace meta::tests
 
     static_assert(is_expected_match(test_regex::search("___test___")));
     static_assert(is_expected_non_match(test_regex::search("xxx")));
-}
\ No newline at end of file
+
+    // Captures in repetitions hold the last iteration
+    static_assert(regex<R"((\d\d)+)">::match("123456").group<1>().content() == "56");
+    static_assert(regex<R"((\d\d)+\d\d\d)">::match("12345").group<1>().content() == "12");
+    static_assert(regex<R"((\d\d)+?x)">::match("1234x").group<1>().content() == "34");
+    static_assert(regex<R"((\d\d)*+x)">::match("1234x").group<1>().content() == "34");
+    static_assert(regex<R"((ab|cd)+)">::match("abcdab").group<1>().content() == "ab");
+    static_assert(regex<R"((\d\d)*x)">::match("x").group<1>().is_empty());
+    static_assert(regex<R"((\d\d)+(\d)\1)">::match("1234534").group<1>().content() == "34");
+    // Captures are only stored on the successful path
+    static_assert(regex<R"((a)x|ay)">::match("ay").group<1>().is_empty());
+    static_assert(regex<R"((a)(b)x|(a)y)">::match("ay").group<2>().is_empty());
+    static_assert(regex<R"((\w+)@(\w+)\.com)">::search("a@b.org c@d.com").group<2>().content() == "d");
+    static_assert(regex<R"(((a)|b)+c)">::match("abc").group<2>().content() == "a");
+
+    // Offset-based storage
+    using date_regex = regex<R"((?<day>\d\d)/(\d\d)(?:/(\d{4}))?)">;
+    using compact_date_type = compact_match_result<date_regex, std::string_view::iterator>;
+    using wide_compact_date_type = compact_match_result<date_regex, std::string_view::iterator, std::uint64_t>;
+
+    static_assert(sizeof(compact_date_type) < sizeof(match_result_view<date_regex, std::string_view::iterator>));
+    static_assert(wide_compact_date_type::group_count == 4);
+
+    namespace
+    {
+        inline constexpr std::string_view date_input = "on 07/08";
+        inline constexpr std::string_view invalid_date_input = "07-08";
+        inline constexpr std::string_view lookbehind_input = "a1";
+
+        // Group 1 is entered, but abandoned when the following 'b' does not match
+        using abandoned_group_regex = regex<R"((?:(a)b)?a)">;
+        inline constexpr std::string_view abandoned_group_input = "a";
+        inline constexpr std::string_view empty_group_input = "b";
+
+        constexpr bool is_expected_compact_date(compact_date_type const &res) noexcept
+        {
+            auto [all, day, month, year] = res;
+            return res.matched() &&
+                   res.length() == 5 &&
+                   all.content() == "07/08" &&
+                   day.content() == "07" &&
+                   res.group<"day">().content() == "07" &&
+                   month.content() == "08" &&
+                   year.is_empty() &&
+                   res.as_view().group<2>().content() == "08" &&
+                   std::distance(date_input.begin(), res.begin()) == 3;
+        }
+    }
+
+    static_assert(is_expected_compact_date(date_regex::search(date_input).as_compact(date_input.begin())));
+    static_assert(!date_regex::search(invalid_date_input).as_compact(invalid_date_input.begin()).matched());
+    static_assert(regex<R"((?<=(\w))\d)">::search(lookbehind_input).as_compact<std::uint8_t>(lookbehind_input.begin()).group<1>().content() == "a");
+    static_assert(regex<R"((?<=(\w))\d)">::search(lookbehind_input).as_compact<std::uint8_t>(lookbehind_input.begin()).group<0>().begin() == lookbehind_input.begin() + 1);
+    static_assert(abandoned_group_regex::match(abandoned_group_input).group<1>().matched() == false);
+    static_assert(abandoned_group_regex::match(abandoned_group_input).as_compact(abandoned_group_input.begin()).group<1>().matched() == false);
+    static_assert(abandoned_group_regex::match(abandoned_group_input).as_compact(abandoned_group_input.begin()).group<0>().matched());
+    static_assert(regex<R"((a*)b)">::match(empty_group_input).as_compact(empty_group_input.begin()).group<1>().matched());
+
+    // Typed conversion of captures
+    namespace
+    {
+        struct point
+        {
+            int x;
+            std::int8_t y;
+            std::string_view label;
+        };
+
+        using point_regex = regex<R"(([-+]?\d+),(-?\d+)(?::(\w*))?)">;
+
+        enum struct severity : std::uint8_t
+        {
+            info = 1,
+            error = 3
+        };
+
+        struct log_level
+        {
+            severity level;
+            bool fatal;
+        };
+
+        constexpr bool is_expected_point(std::optional<point> const &p, int x, std::int8_t y, std::string_view label) noexcept
+        {
+            return p.has_value() && p->x == x && p->y == y && p->label == label;
+        }
+    }
+
+    static_assert(capture_convertible<unsigned long>);
+    static_assert(capture_convertible<std::string_view>);
+    static_assert(capture_convertible<point> == false);
+    static_assert(is_expected_point(point_regex::parse_into<point>("-3,42:abc"), -3, 42, "abc"));
+    static_assert(is_expected_point(point_regex::parse_into<point>("+7,-128"), 7, -128, ""));
+    static_assert(point_regex::parse_into<point>("1,128").has_value() == false);
+    static_assert(point_regex::parse_into<point>("1;2").has_value() == false);
+    static_assert(point_regex::parse_into<point>("-2147483649,0").has_value() == false);
+    static_assert(detail::aggregate_member_count<point>() == 3);
+    static_assert(detail::aggregate_member_count<log_level>() == 2);
+    static_assert(capture_convertible<severity>);
+    static_assert(regex<R"((\d+) (\w+))">::parse_into<log_level>("3 true")->level == severity::error);
+    static_assert(regex<R"((\d+) (\w+))">::parse_into<log_level>("256 true").has_value() == false);
+
+    namespace
+    {
+        /**
+         * Checks that owning results keep a group which was entered and then abandoned unset,
+         * both for contiguous input and for input whose groups are copied one by one.
+         */
+        bool has_unset_abandoned_owning_groups()
+        {
+            auto const view_result = abandoned_group_regex::match(abandoned_group_input);
+            std::list<char> const list_input{'a'};
+            auto const list_result = abandoned_group_regex::match(list_input.begin(), list_input.end());
+
+            return !view_result.as_memory_owner().group<1>().matched() &&
+                   view_result.as_memory_owner().group<0>().matched() &&
+                   !view_result.as_buffered_owner().group<1>().matched() &&
+                   view_result.as_buffered_owner().group<0>() == abandoned_group_input &&
+                   !list_result.as_buffered_owner().group<1>().matched() &&
+                   list_result.as_buffered_owner().group<0>() == abandoned_group_input;
+        }
+
+        register_runtime_test const abandoned_owning_group_test{"owning results keep abandoned groups unset", &has_unset_abandoned_owning_groups};
+    }
+}
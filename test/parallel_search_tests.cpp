@@ -0,0 +1,70 @@
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <mregex.hpp>
+#include <mregex/parallel_search.hpp>
+#include "runtime_tests.hpp"
+
+namespace meta::tests
+{
+    static_assert(
+            std::is_same_v<
+                    decltype(find_all_parallel<regex<"a">>(std::string_view{})),
+                    std::vector<match_result_view<regex<"a">, std::string_view::const_iterator>>
+            >
+    );
+
+    namespace
+    {
+        using match_offsets = std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>>;
+
+        template<typename Matches>
+        auto offsets_of(std::string_view input, Matches &&matches) -> match_offsets
+        {
+            match_offsets offsets;
+            for (auto const &match : matches)
+                offsets.emplace_back(match.begin() - input.begin(), match.end() - input.begin());
+            return offsets;
+        }
+
+        /**
+         * Searches the input with small chunks and several thread counts and checks
+         * that the matches are the ones generated sequentially by find_all().
+         */
+        template<static_string Pattern>
+        bool searches_in_parallel_like_find_all(std::string_view input)
+        {
+            using pattern = regex<Pattern>;
+            using parallel_search_type = parallel_search<regex_search_method<pattern>, std::string_view::const_iterator>;
+
+            auto const expected = offsets_of(input, pattern::find_all(input));
+            for (std::size_t chunk_size : {1, 2, 3, 5, 8, 64})
+            {
+                for (std::size_t thread_count : {1, 2, 3, 8})
+                {
+                    auto const matches = parallel_search_type::find_all(input.begin(), input.end(), thread_count, chunk_size);
+                    if (offsets_of(input, matches) != expected)
+                        return false;
+                }
+            }
+            return offsets_of(input, find_all_parallel<pattern>(input, 2)) == expected;
+        }
+
+        bool has_parallel_matches()
+        {
+            std::string_view const input = "tok_12 tok_abc;xx tok_ tok_4567 aaa ab aab\nx1 y22 x333 end";
+            return searches_in_parallel_like_find_all<R"(tok_\w+)">(input) &&
+                   searches_in_parallel_like_find_all<R"(\b\w{2}\b)">(input) &&
+                   searches_in_parallel_like_find_all<R"((?<=x)\d+)">(input) &&
+                   searches_in_parallel_like_find_all<R"(a+b?)">(input) &&
+                   searches_in_parallel_like_find_all<R"(\w+$)">(input) &&
+                   searches_in_parallel_like_find_all<R"(\s+|\d+)">(input) &&
+                   searches_in_parallel_like_find_all<R"(a*)">(input) &&
+                   searches_in_parallel_like_find_all<R"(x*)">("xxx y") &&
+                   searches_in_parallel_like_find_all<R"(q)">(input) &&
+                   searches_in_parallel_like_find_all<R"(.*)">(input);
+        }
+
+        register_runtime_test const parallel_search_test{"find_all_parallel finds the matches of find_all", &has_parallel_matches};
+    }
+}
@@ -17,8 +17,173 @@ namespace meta::tests
             using pattern = regex<Pattern, Flags ...>;
             return std::ranges::distance(pattern::tokenize(sv));
         }
+
+        template<static_string Pattern, regex_flag... Flags>
+        constexpr auto cursor_count(std::string_view sv)
+        {
+            using pattern = regex<Pattern, Flags ...>;
+            auto cursor = pattern::cursor(sv);
+            return std::ranges::distance(cursor);
+        }
+
+        constexpr bool has_expected_cursor_groups()
+        {
+            auto cursor = regex<R"((a)x|y)">::cursor("ax y ax");
+            bool first = cursor.group<1>().content() == "a";
+            cursor.next();
+            bool second = !cursor.group<1>().matched() && cursor.group<0>().content() == "y";
+            auto saved = cursor.result();
+            cursor.next();
+            bool third = cursor.matched() && cursor.group<0>().content() == "ax" && saved.group<0>().content() == "y";
+            return first && second && third && !cursor.next();
+        }
     }
 
+    namespace
+    {
+        using kv_regex = regex<R"((?<key>\w+)=(\d+)?;)">;
+
+        constexpr bool has_expected_columns()
+        {
+            std::array<capture_offsets, 9> storage{};
+            capture_span_columns<kv_regex> columns{storage};
+            auto status = kv_regex::extract_all("a=1; bc=; d=23;", columns);
+            auto keys = columns.column<"key">();
+            auto values = columns.column<2>();
+            return status.count == 3 && !status.overflow &&
+                   columns.size() == 3 &&
+                   keys[1] == capture_offsets{5, 7} &&
+                   !values[1].is_set() &&
+                   values[2].begin == 12 && values[2].length() == 2 &&
+                   columns.column<0>()[0] == capture_offsets{0, 4};
+        }
+
+        constexpr bool has_expected_overflow()
+        {
+            std::array<capture_offsets, 6> storage{};
+            capture_span_columns<kv_regex> columns{storage};
+            auto status = kv_regex::extract_all("a=1; b=2; c=3;", columns);
+            return status.count == 2 && status.overflow && columns.overflowed() && columns.column<"key">().size() == 2;
+        }
+
+        constexpr bool has_unset_abandoned_column()
+        {
+            // Group 1 is entered, but abandoned when the following 'b' does not match
+            using abandoned_group_regex = regex<R"((?:(a)b)?a)">;
+            std::array<capture_offsets, 4> storage{};
+            capture_span_columns<abandoned_group_regex> columns{storage};
+            auto status = abandoned_group_regex::extract_all("a aba", columns);
+            return status.count == 2 &&
+                   !columns.column<1>()[0].is_set() &&
+                   columns.column<1>()[1] == capture_offsets{2, 3} &&
+                   columns.column<0>()[1] == capture_offsets{2, 5} &&
+                   columns.column<0>()[0] == capture_offsets{0, 1};
+        }
+    }
+
+    namespace
+    {
+        template<static_string Pattern, std::size_t N>
+        constexpr bool splits_to(std::string_view input, std::array<std::string_view, N> const &expected)
+        {
+            std::size_t count = 0;
+            for (auto const &segment : regex<Pattern>::split(input))
+            {
+                if (count == N || segment != expected[count])
+                    return false;
+                ++count;
+            }
+            return count == N;
+        }
+
+        template<static_string Pattern, bool Inverted = false, std::size_t N>
+        constexpr bool selects_lines(std::string_view input, std::array<std::string_view, N> const &expected)
+        {
+            using pattern = regex<Pattern>;
+            using line_range_type = typename pattern::template line_range_type<std::string_view::iterator, Inverted>;
+
+            std::size_t count = 0;
+            for (auto const &line : line_range_type{input.begin(), input.end()})
+            {
+                if (count == N || line != expected[count])
+                    return false;
+                ++count;
+            }
+            return count == N;
+        }
+    }
+
+    static_assert(std::ranges::input_range<regex<",">::split_range_type<std::string_view::iterator>>);
+    static_assert(std::ranges::view<regex<",">::split_range_type<std::string_view::iterator>>);
+    static_assert(splits_to<R"(\s*,\s*)">("a , b,c", std::array<std::string_view, 3>{"a", "b", "c"}));
+    static_assert(splits_to<R"(\r?\n)">("x\r\ny\n", std::array<std::string_view, 3>{"x", "y", ""}));
+    static_assert(splits_to<R"(,)">(",", std::array<std::string_view, 2>{"", ""}));
+    static_assert(splits_to<R"(,)">("", std::array<std::string_view, 1>{""}));
+    static_assert(splits_to<R"(,)">("abc", std::array<std::string_view, 1>{"abc"}));
+    static_assert(splits_to<R"(\s*)">("a bc  d", std::array<std::string_view, 3>{"a", "bc", "d"}));
+    static_assert(splits_to<R"((?<=a)-)">("a-b-a-", std::array<std::string_view, 3>{"a", "b-a", ""}));
+
+    static_assert(std::ranges::input_range<regex<"x">::line_range_type<std::string_view::iterator>>);
+    static_assert(selects_lines<R"(ab+)">("ab\nxx\nxabb\na", std::array<std::string_view, 2>{"ab", "xabb"}));
+    static_assert(selects_lines<R"(ab+)", true>("ab\nxx\nxabb\na", std::array<std::string_view, 2>{"xx", "a"}));
+    static_assert(selects_lines<R"(^b|c$)">("ab\nb\ncx\nxc", std::array<std::string_view, 2>{"b", "xc"}));
+    static_assert(selects_lines<R"(a\sb)">("a\nb\na b", std::array<std::string_view, 1>{"a b"}));
+    static_assert(selects_lines<R"(^$)">("a\n\nb\n", std::array<std::string_view, 1>{""}));
+    static_assert(selects_lines<R"(x*)", true>("a\nb", std::array<std::string_view, 0>{}));
+    static_assert(selects_lines<R"(x)", true>("", std::array<std::string_view, 0>{}));
+    static_assert(selects_lines<R"(error)", true>("error\nok\n", std::array<std::string_view, 1>{"ok"}));
+    static_assert(selects_lines<R"(^$)">("\n", std::array<std::string_view, 1>{""}));
+    static_assert(selects_lines<R"(^$)">("\n\n", std::array<std::string_view, 2>{"", ""}));
+    static_assert(selects_lines<R"(a$)">("xa\nya\n", std::array<std::string_view, 2>{"xa", "ya"}));
+    static_assert(regex<R"(x)">::non_matching_lines("a\n").count() == 1);
+    static_assert(regex<R"()">::matching_lines("").count() == 0);
+
+    namespace
+    {
+        template<static_string Format, static_string Pattern>
+        constexpr bool replaces_all_to(std::string_view input, std::string_view expected)
+        {
+            using pattern = regex<Pattern>;
+            std::array<char, 64> buffer{};
+            auto last = pattern::template replace_all<Format>(input, buffer.begin());
+            std::string_view const output{buffer.begin(), last};
+            return output == expected && pattern::template replace_all_size<Format>(input) == expected.size();
+        }
+
+        template<static_string Format, static_string Pattern>
+        constexpr bool replaces_to(std::string_view input, std::string_view expected)
+        {
+            using pattern = regex<Pattern>;
+            std::array<char, 64> buffer{};
+            auto last = pattern::template replace<Format>(input, buffer.begin());
+            std::string_view const output{buffer.begin(), last};
+            return output == expected && pattern::template replace_size<Format>(input) == expected.size();
+        }
+    }
+
+    static_assert(replaces_to<"$2/$1", R"((\d+)-(\d+))">("from 1-2 to 3-4", "from 2/1 to 3-4"));
+    static_assert(replaces_to<"x", R"(a)">("bbb", "bbb"));
+    static_assert(replaces_all_to<"$2/$1", R"((\d+)-(\d+))">("from 1-2 to 3-4", "from 2/1 to 4/3"));
+    static_assert(replaces_all_to<"<$<user>@***>", R"((?<user>\w+)@\w+\.com)">("a@b.com, cd@ef.com", "<a@***>, <cd@***>"));
+    static_assert(replaces_all_to<"[$0]", R"(a*)">("aa", "[aa][]"));
+    static_assert(replaces_all_to<"$$$1", R"(\$?(\d+))">("costs $12 or 3", "costs $12 or $3"));
+    static_assert(replaces_all_to<"$1", R"((a)|b)">("abc", "ac"));
+    static_assert(replaces_all_to<"", R"(\s+)">(" a  b ", "ab"));
+    static_assert(replace_format<regex<R"((a)(?<b>b))">, "$<b>$1$$">::piece_count == 3);
+
+    static_assert(has_expected_columns());
+    static_assert(has_expected_overflow());
+    static_assert(has_unset_abandoned_column());
+    static_assert(capture_offsets_sink<capture_columns<kv_regex>, 3>);
+    static_assert(std::ranges::input_range<regex_cursor_t<regex<"a">, std::string_view::iterator>>);
+    static_assert(has_expected_cursor_groups());
+    static_assert(cursor_count<R"()">("a") == 1);
+    static_assert(cursor_count<R"(a)">("") == 0);
+    static_assert(cursor_count<R"(a+)">("a aa aaa") == 3);
+    static_assert(cursor_count<R"(a*)">("aa") == 2);
+    static_assert(cursor_count<R"(a+)", regex_flag::ungreedy>("a aa aaa") == 6);
+    static_assert(cursor_count<R"(\w+@\w+)">("a@b, c@d e@f") == 3);
+
     static_assert(match_count<R"()">("") == 1);
     static_assert(match_count<R"()">("a") == 1);
     static_assert(match_count<R"(a)">("a") == 1);
@@ -55,6 +220,24 @@ namespace meta::tests
     static_assert(match_count<R"(.+)", regex_flag::ungreedy>("123456") == 6);
     static_assert(match_count<R"(.+?)", regex_flag::ungreedy>("123456") == 1);
 
+    static_assert(regex<R"(a+)">::count("a aa aaa") == static_cast<std::size_t>(match_count<R"(a+)">("a aa aaa")));
+    static_assert(regex<R"(a*)">::count("aa") == static_cast<std::size_t>(match_count<R"(a*)">("aa")));
+    static_assert(regex<R"()">::count("") == 1);
+    static_assert(regex<R"(x)">::count("") == 0);
+    static_assert(regex<R"((\w)\1)">::count("aa bc dd") == 2);
+    static_assert(regex<R"((?:(a)|b)\1)">::count("aa bb b") == static_cast<std::size_t>(match_count<R"((?:(a)|b)\1)">("aa bb b")));
+    static_assert(regex<R"(a+)", regex_flag::ungreedy>::count("a aa aaa") == 6);
+    static_assert(regex<R"(error)">::count_lines("error\nok\nerror error\n") == 2);
+    static_assert(regex<R"(^$)">::count_lines("a\n\nb\n") == 1);
+    static_assert(regex<R"(^$)">::count_lines("a\n\nb") == 1);
+    static_assert(regex<R"(^$)">::count_lines("\n") == 1);
+    static_assert(regex<R"()">::count_lines("") == 0);
+    static_assert(regex<R"(x)">::count_lines("") == 0);
+    static_assert(regex<R"(error)">::count_non_matching_lines("error\nok\nerror error\n") == 1);
+    static_assert(regex<R"(\d)">::count_non_matching_lines("1\n2\n3") == 0);
+    static_assert(regex<R"(error)">::count_non_matching_lines("error\nok\n") == 1);
+    static_assert(regex<R"(x)">::count_non_matching_lines("") == 0);
+
     static_assert(token_count<R"()">("") == 1);
     static_assert(token_count<R"()">("a") == 1);
     static_assert(token_count<R"(a)">("a") == 1);
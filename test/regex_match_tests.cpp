@@ -2,6 +2,71 @@
 
 namespace meta::tests
 {
+    namespace
+    {
+        /**
+         * Builds a long quoted string with escape sequences.
+         * Matching it with a recursive repetition would exceed the constexpr evaluation depth.
+         */
+        template<std::size_t N>
+        constexpr auto make_long_quoted_string() noexcept
+        {
+            std::array<char, N> buffer{};
+            for (std::size_t i = 1; i + 1 < N; i += 3)
+            {
+                buffer[i] = 'a';
+                buffer[i + 1] = '\\';
+                buffer[i + 2] = '"';
+            }
+            buffer.front() = '"';
+            buffer[N - 2] = 'a';
+            buffer.back() = '"';
+            return buffer;
+        }
+
+        /**
+         * Matches two inputs with the same context and checks that no capturing group
+         * stored by the first match survives the reset before the second one.
+         */
+        template<static_string Pattern>
+        constexpr bool is_reset_between_matches(std::string_view first, std::string_view second) noexcept
+        {
+            using regex_type = regex<Pattern>;
+            using method = regex_match_method<regex_type>;
+
+            regex_match_context<regex_type, std::string_view::const_iterator> ctx{};
+            method::invoke(first.begin(), first.end(), first.begin(), ctx);
+            ctx.reset();
+            if (ctx.capture_watermark != 0 || !get_group<1>(ctx.captures).is_empty() || !get_group<2>(ctx.captures).is_empty())
+                return false;
+
+            bool const matched = method::invoke(second.begin(), second.end(), second.begin(), ctx).matched;
+            return matched && get_group<1>(ctx.captures).is_empty() && get_group<2>(ctx.captures).length() == second.size();
+        }
+
+        inline constexpr auto long_quoted_string = make_long_quoted_string<3002>();
+
+        template<static_string Pattern, std::size_t N>
+        constexpr auto test_batch(std::array<std::string_view, N> const &inputs) noexcept
+        {
+            std::array<bool, N> results{};
+            regex<Pattern>::match_batch(inputs, results);
+            return results;
+        }
+
+        template<static_string Pattern, std::size_t N>
+        constexpr auto first_group_lengths(std::array<std::string_view, N> const &inputs) noexcept
+        {
+            std::array<typename regex<Pattern>::batch_result_type, N> results{};
+            regex<Pattern>::match_batch(inputs, results);
+
+            std::array<std::size_t, N> lengths{};
+            for (std::size_t i = 0; i != N; ++i)
+                lengths[i] = results[i] ? results[i].template group<1>().length() : 0;
+            return lengths;
+        }
+    }
+
     /**
      * Matching tests.
      */
@@ -164,6 +229,36 @@ namespace meta::tests
     static_assert(regex<R"((?:ab|a)++b)">::match("ababb"));
     static_assert(regex<R"((?:a|(?:))+)">::match(""));
     static_assert(regex<R"(hello|salut|bonjour)", regex_flag::icase>::match("SaLuT"));
+    static_assert(regex<R"(error_code|error_msg|error_type)">::match("error_msg"));
+    static_assert(regex<R"(error_code|error_msg|error_type)", regex_flag::icase>::match("ERROR_Type"));
+    static_assert(regex<R"((?>in|insert|integer)sert)">::match("insert"));
+    static_assert(regex<R"((?>ab|a)b)">::match("abb"));
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("\"abc\""));
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("1234"));
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("false"));
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)", regex_flag::icase>::match("NULL"));
+    static_assert(regex<R"((?:\d+|x)|\d+y)">::match("12y"));
+    static_assert(regex<R"((?:\b|x)\w+|-)">::match("ab"));
+    static_assert(regex<R"(\d+-\d+)">::match("123-45"));
+    static_assert(regex<R"([a-z]*?\s[a-z]+)", regex_flag::ungreedy>::match("abc def"));
+    static_assert(regex<R"((?<=\d\d+-)x)">::search("12-x"));
+    static_assert(regex<R"([a-z]+A)", regex_flag::icase>::match("abcdA"));
+    static_assert(regex<R"((?:\d\d)+)">::match("123456"));
+    static_assert(regex<R"((?:\d\d)+\d\d\d)">::match("12345"));
+    static_assert(regex<R"((?:\d\d)+?\d\d\d)">::match("1234567"));
+    static_assert(regex<R"((?:\d\d){2,}+\d)">::match("12345"));
+    static_assert(regex<R"((?:[0-9a-f]{2}:)*[0-9a-f]{2})">::match("de:ad:be:ef"));
+    static_assert(regex<R"((?:ab|cd)+a)">::match("abcdcda"));
+    static_assert(regex<R"((?:(?:ab|cd){2}x)+)">::match("abcdxcdcdx"));
+    static_assert(regex<R"("(?:\\.|[^\\"])*")">::match(long_quoted_string));
+    static_assert(regex<R"("(?:\\.|[^\\"])*?")">::match(long_quoted_string));
+    static_assert(regex<R"((?:\\.|[^\\"])*")">::match_prefix(R"(ab\"c"d")").length() == 6);
+    static_assert(regex<R"((?:ab|c)*c)">::match("ababcc"));
+    static_assert(regex<R"((?:ab|c){2,4}ab)">::match("ccabab"));
+    static_assert(regex<R"((?:a|bc){3}x)">::match("abcax"));
+    static_assert(regex<R"((\d+)-(\d+))">::test("12-34"));
+    static_assert(regex<R"((?<word>[a-z]+):\k<word>)">::test("abc:abc"));
+    static_assert(regex<R"((a)(b)\2)">::test(std::string{"abb"}));
     // Backreferences
     static_assert(regex<R"(([a-z]+):\1)">::match("abcd:abcd"));
     static_assert(regex<R"(([a-z]+):\1)", regex_flag::icase>::match("abcd:abcd"));
@@ -406,4 +501,27 @@ namespace meta::tests
     static_assert(regex<R"(^(?>(?:ab.?){2,})x)">::match("abcabcababcx") == false);
     static_assert(regex<R"((?>in|insert|integer))">::match("integer") == false);
     static_assert(regex<R"((?>in|insert|integer))">::match("insert") == false);
-}
\ No newline at end of file
+    static_assert(regex<R"((?>ab|a)b)">::match("ab") == false);
+    static_assert(regex<R"(error_code|error_msg|error_type)">::match("error_") == false);
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("nul") == false);
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("") == false);
+    static_assert(regex<R"("[^"]*"|\d+|true|false|null)">::match("TRUE") == false);
+    static_assert(regex<R"(\d+-\d+)">::match("12345") == false);
+    static_assert(regex<R"((?:\d\d)+)">::match("12345") == false);
+    static_assert(regex<R"((?:\d\d)+\d\d\d)">::match("123456") == false);
+    static_assert(regex<R"((?:\d\d){2,}+\d\d\d)">::match("1234567") == false);
+    static_assert(regex<R"((?:ab|cd)+a)">::match("abcxa") == false);
+    static_assert(regex<R"((\d+)-(\d+))">::test("12-34-") == false);
+    static_assert(regex<R"((?<word>[a-z]+):\k<word>)">::test("abc:abd") == false);
+    static_assert(regex<R"((a)(b)\2)">::test("aba") == false);
+
+    // Context reuse
+    static_assert(is_reset_between_matches<R"((a)?(b)?)">("a", "b"));
+    static_assert(is_reset_between_matches<R"((a+)?(b+)?)">("aa", "bbb"));
+
+    // Batch matching
+    static_assert(test_batch<R"(\d{2}-\d{2})">(std::array<std::string_view, 4>{"12-34", "1-234", "12-345", ""}) == std::array{true, false, false, false});
+    static_assert(test_batch<R"((\w)\1*)">(std::array<std::string_view, 3>{"aaa", "ab", "b"}) == std::array{true, false, true});
+    static_assert(test_batch<R"(a?)">(std::array<std::string_view, 3>{"", "a", "aa"}) == std::array{true, true, false});
+    static_assert(first_group_lengths<R"((\w+)@\w+)">(std::array<std::string_view, 3>{"ab@c", "@c", "xyz@w"}) == std::array<std::size_t, 3>{2, 0, 3});
+}
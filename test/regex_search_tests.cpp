@@ -11,6 +11,8 @@ namespace meta::tests
     static_assert(uri_regex::search("https://google.com       "));
     static_assert(uri_regex::search("... https://google.com ..."));
     static_assert(uri_regex::search("... https://google.com\n ... https://youtube.com ..."));
+    static_assert(uri_regex::contains("... https://google.com ..."));
+    static_assert(regex<R"((\w)\1)">::contains("abccd"));
     static_assert(email_regex::search("sample@gmail.com"));
     static_assert(email_regex::search("      sample@gmail.com"));
     static_assert(email_regex::search("sample@gmail.com      "));
@@ -42,4 +44,6 @@ namespace meta::tests
     static_assert(regex<"abc$">::search("... abc ") == false);
     static_assert(regex<" ^">::search("") == false);
     static_assert(regex<"$ ">::search("") == false);
-}
\ No newline at end of file
+    static_assert(uri_regex::contains("... google.com ...") == false);
+    static_assert(regex<R"((\w)\1)">::contains("abcd") == false);
+}
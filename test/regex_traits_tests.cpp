@@ -48,4 +48,9 @@ namespace meta::tests
     static_assert(std::is_same_v<uri_match_range_t, decltype(email_regex::find_all(""))> == false);
     static_assert(std::is_same_v<uri_match_range_t, decltype(uri_regex::find_all(std::string{}))> == false);
     static_assert(std::is_same_v<uri_match_range_t, decltype(uri_regex::tokenize(""))> == false);
-}
\ No newline at end of file
+
+    using token_stream_searcher_t = regex_stream_searcher_t<regex<R"(\btok_\w{1,8}(?=[ ;]))">>;
+    static_assert(token_stream_searcher_t::window_width == 13);
+    static_assert(token_stream_searcher_t::lookbehind_reach == 1);
+    static_assert(regex_stream_searcher_t<regex<R"(\w+)">>::window_width == ast::unbounded_width);
+}
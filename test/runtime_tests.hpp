@@ -0,0 +1,35 @@
+#ifndef MREGEX_RUNTIME_TESTS_HPP
+#define MREGEX_RUNTIME_TESTS_HPP
+
+#include <vector>
+
+namespace meta::tests
+{
+    /**
+     * Test which cannot be evaluated at compile-time, since it needs threads,
+     * files or allocations which must outlive a constant expression.
+     */
+    struct runtime_test
+    {
+        char const *name;
+        bool (*run)();
+    };
+
+    inline auto runtime_tests() -> std::vector<runtime_test> &
+    {
+        static std::vector<runtime_test> tests;
+        return tests;
+    }
+
+    /**
+     * Registers a runtime test during static initialization.
+     */
+    struct register_runtime_test
+    {
+        register_runtime_test(char const *name, bool (*run)())
+        {
+            runtime_tests().push_back(runtime_test{name, run});
+        }
+    };
+}
+#endif //MREGEX_RUNTIME_TESTS_HPP
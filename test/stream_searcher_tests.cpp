@@ -0,0 +1,97 @@
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <mregex.hpp>
+#include "runtime_tests.hpp"
+
+namespace meta::tests
+{
+    namespace
+    {
+        using found_matches = std::vector<std::pair<std::size_t, std::string>>;
+
+        template<static_string Pattern>
+        auto find_all_non_empty(std::string_view input) -> found_matches
+        {
+            found_matches matches;
+            for (auto const &match : regex<Pattern>::find_all(input))
+            {
+                if (match.length() != 0)
+                    matches.emplace_back(static_cast<std::size_t>(match.begin() - input.begin()), std::string{match.begin(), match.end()});
+            }
+            return matches;
+        }
+
+        /**
+         * Feeds the input to a stream searcher in chunks of every size up to the input size
+         * and checks that the offsets and contents of the matches are the ones found by find_all().
+         */
+        template<static_string Pattern>
+        bool streams_like_find_all(std::string_view input)
+        {
+            auto const expected = find_all_non_empty<Pattern>(input);
+            for (std::size_t chunk_size = 1; chunk_size <= input.size(); ++chunk_size)
+            {
+                found_matches actual;
+                auto const record = [&](auto const &match, std::size_t offset) {
+                    actual.emplace_back(offset, std::string{match.begin(), match.end()});
+                };
+
+                typename regex<Pattern>::stream_searcher_type searcher;
+                for (std::size_t i = 0; i < input.size(); i += chunk_size)
+                    searcher.feed(input.substr(i, chunk_size), record);
+                searcher.finish(record);
+
+                if (actual != expected)
+                    return false;
+            }
+            return true;
+        }
+
+        bool has_chunked_stream_matches()
+        {
+            return streams_like_find_all<R"(tok_\w{1,8})">("tok_a tok_abcdefghij xtok_b tok_") &&
+                   streams_like_find_all<R"(\bab\b)">("ab abc cab ab,ab") &&
+                   streams_like_find_all<R"(\btok_\w{1,8}(?=[ ;]))">("tok_a; xtok_b tok_cc tok_d") &&
+                   streams_like_find_all<R"((?<=x)\d+)">("x12 y34 x5 xx678") &&
+                   streams_like_find_all<R"((?<!\d)\d{2})">("1234 56 7 89") &&
+                   streams_like_find_all<R"(\w+$)">("ab cd efg") &&
+                   streams_like_find_all<R"(\d\Z)">("1 2 3") &&
+                   streams_like_find_all<R"(\d\Z)">("1 2 3 ") &&
+                   streams_like_find_all<R"(a+)">("aaa b aaaa");
+        }
+
+        bool has_crossing_match_offset()
+        {
+            found_matches actual;
+            auto const record = [&](auto const &match, std::size_t offset) {
+                actual.emplace_back(offset, std::string{match.begin(), match.end()});
+            };
+
+            regex<R"(tok_\d+;)">::stream_searcher_type searcher;
+            searcher.feed("xx to", record);
+            searcher.feed("k_12", record);
+            searcher.feed("3; tok_4;", record);
+            searcher.finish(record);
+            return actual == found_matches{{3, "tok_123;"}, {12, "tok_4;"}};
+        }
+
+        bool has_unsplit_unbounded_matches()
+        {
+            std::string const input = "x " + std::string(10000, 'w') + " y " + std::string(5000, 'z');
+            auto const expected = find_all_non_empty<R"(\w+)">(input);
+
+            found_matches actual;
+            std::istringstream stream{input};
+            regex<R"(\w+)">::for_each_match(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}, [&](auto const &match, std::size_t offset) {
+                actual.emplace_back(offset, std::string{match.begin(), match.end()});
+            });
+            return expected.size() == 4 && actual == expected;
+        }
+
+        register_runtime_test const chunked_stream_test{"stream_searcher finds the matches of find_all", &has_chunked_stream_matches};
+        register_runtime_test const crossing_match_test{"stream_searcher reports matches across chunks", &has_crossing_match_offset};
+        register_runtime_test const unbounded_match_test{"for_each_match does not split unbounded matches", &has_unsplit_unbounded_matches};
+    }
+}
@@ -1,6 +1,21 @@
 #include <iostream>
+#include "runtime_tests.hpp"
 
 int main()
 {
     std::cout << "All compile-time tests were successful.\n";
-}
\ No newline at end of file
+
+    int failed_count = 0;
+    for (auto const &test : meta::tests::runtime_tests())
+    {
+        if (!test.run())
+        {
+            std::cout << "Runtime test failed: " << test.name << '\n';
+            ++failed_count;
+        }
+    }
+
+    if (failed_count != 0)
+        return 1;
+    std::cout << "All runtime tests were successful.\n";
+}
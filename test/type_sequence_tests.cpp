@@ -85,4 +85,15 @@ namespace meta::tests
             type_sequence<signed, unsigned, double, float, long, short, char, void>
         >
     );
+    static_assert(std::is_same_v<unpack_t<std::tuple, type_sequence<int, char>>, std::tuple<int, char>>);
+    static_assert(contains<type_sequence<int, char>, char>);
+    static_assert(contains<type_sequence<int, char>, long> == false);
+    static_assert(std::is_same_v<unique_t<type_sequence<>>, type_sequence<>>);
+    static_assert(
+        std::is_same_v
+        <
+            unique_t<type_sequence<int, char, int, long, char, int>>,
+            type_sequence<int, char, long>
+        >
+    );
 }
\ No newline at end of file